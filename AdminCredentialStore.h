@@ -0,0 +1,443 @@
+#ifndef ADMIN_CREDENTIAL_STORE_H // If ADMIN_CREDENTIAL_STORE_H is not defined,
+#define ADMIN_CREDENTIAL_STORE_H // Define ADMIN_CREDENTIAL_STORE_H to prevent multiple inclusions.
+
+#include <stdio.h> // Includes standard input/output functions.
+#include <string.h> // Includes string handling functions.
+#include <stdlib.h> // Includes standard library functions like malloc and rand.
+#include <stdint.h> // Includes fixed-width integers used by SHA-256.
+#include <time.h> // Includes time functions used to seed the fallback salt source.
+#include <sys/stat.h> // Includes stat() to notice when the admin file changes.
+
+#include "FileHandling.h" // Includes MAX_ID_LENGTH and the other shared record limits.
+
+#define ADMIN_HASH_PREFIX "$s1$" // Marks a password field that holds a salted hash (version 1) rather than plaintext.
+#define ADMIN_HASH_ITERATIONS 10000 // Defines how many SHA-256 rounds version 1 hashes use.
+#define ADMIN_SALT_BYTES 6 // Defines the length of each random salt.
+#define ADMIN_HASH_BYTES 16 // Defines how much of the SHA-256 digest is stored (the first 128 bits).
+#define ADMIN_CREDENTIAL_LENGTH 128 // Defines the longest password field the store keeps.
+#define ADMIN_STORE_INITIAL_BUCKETS 256 // Defines the starting size of the hash index.
+#define ADMIN_PASSWORD_FIELD_LIMIT 49 // Defines the longest password field the other modules can read (a 50-byte buffer).
+// The length of a stored hash: prefix, salt in hex, '$', and the stored part of the digest in hex.
+#define ADMIN_HASHED_FIELD_LENGTH ((int)sizeof(ADMIN_HASH_PREFIX) - 1 + ADMIN_SALT_BYTES * 2 + 1 + ADMIN_HASH_BYTES * 2)
+
+// The hashed form replaces a plaintext password in the same column, so it must fit where a password fits today.
+_Static_assert(ADMIN_HASHED_FIELD_LENGTH <= ADMIN_PASSWORD_FIELD_LIMIT, "A salted admin password hash must fit the existing password column");
+_Static_assert(ADMIN_CREDENTIAL_LENGTH > ADMIN_HASHED_FIELD_LENGTH, "ADMIN_CREDENTIAL_LENGTH is too small to hold a salted admin password hash");
+
+// One admin account in the hash index.
+typedef struct AdminCredentialEntry
+{
+    char adminID[MAX_ID_LENGTH]; // The admin ID used as the key.
+    char credential[ADMIN_CREDENTIAL_LENGTH]; // The stored password field (a salted hash, or plaintext before migration).
+    struct AdminCredentialEntry *next; // The next entry in the same bucket.
+} AdminCredentialEntry;
+
+// The cached hash index of admins.txt and the file state it was built from.
+static struct
+{
+    AdminCredentialEntry **buckets; // The bucket array.
+    unsigned int bucketCount; // The number of buckets (always a power of two).
+    unsigned int entryCount; // The number of admins indexed.
+    char path[256]; // The admin file the index was loaded from.
+    long long fileSize; // The file size when loaded.
+    long long fileMtime; // The file modification time when loaded.
+    long long loadedAt; // The time the file was loaded.
+} adminStore = {NULL, 0, 0, "", -1, -1, -1};
+
+// SHA-256 round constants.
+static const uint32_t ADMIN_SHA256_K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+#define ADMIN_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n)))) // Rotates a 32-bit word right.
+
+// A private helper function to run one SHA-256 compression round over a 64-byte block.
+static inline void adminSha256Block(uint32_t state[8], const unsigned char block[64])
+{
+    uint32_t w[64]; // The message schedule.
+    for (int i = 0; i < 16; i++) // Loads the block as big-endian words.
+    {
+        w[i] = (uint32_t)block[i * 4] << 24 | (uint32_t)block[i * 4 + 1] << 16 | (uint32_t)block[i * 4 + 2] << 8 | block[i * 4 + 3];
+    }
+    for (int i = 16; i < 64; i++) // Extends the schedule.
+    {
+        uint32_t s0 = ADMIN_ROTR(w[i - 15], 7) ^ ADMIN_ROTR(w[i - 15], 18) ^ (w[i - 15] >> 3); // Mixes an earlier word.
+        uint32_t s1 = ADMIN_ROTR(w[i - 2], 17) ^ ADMIN_ROTR(w[i - 2], 19) ^ (w[i - 2] >> 10); // Mixes a recent word.
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1; // Combines them.
+    }
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4], f = state[5], g = state[6], h = state[7]; // Copies the state.
+    for (int i = 0; i < 64; i++) // Runs the 64 rounds.
+    {
+        uint32_t t1 = h + (ADMIN_ROTR(e, 6) ^ ADMIN_ROTR(e, 11) ^ ADMIN_ROTR(e, 25)) + ((e & f) ^ (~e & g)) + ADMIN_SHA256_K[i] + w[i]; // First temporary.
+        uint32_t t2 = (ADMIN_ROTR(a, 2) ^ ADMIN_ROTR(a, 13) ^ ADMIN_ROTR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c)); // Second temporary.
+        h = g; g = f; f = e; e = d + t1; d = c; c = b; b = a; a = t1 + t2; // Shifts the working variables.
+    }
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d; // Adds the result back into the state.
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h; // Continues adding.
+}
+
+// A private helper function to compute the SHA-256 digest of a buffer.
+static inline void adminSha256(const unsigned char *data, size_t length, unsigned char digest[32])
+{
+    uint32_t state[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19}; // The initial hash values.
+    unsigned char block[64]; // A buffer for the final, padded blocks.
+    size_t offset = 0; // The position in the input.
+    for (; offset + 64 <= length; offset += 64) adminSha256Block(state, data + offset); // Processes every full block.
+
+    size_t remaining = length - offset; // The bytes left over.
+    memset(block, 0, sizeof(block)); // Clears the padding block.
+    memcpy(block, data + offset, remaining); // Copies the leftover bytes.
+    block[remaining] = 0x80; // Appends the padding marker.
+    if (remaining >= 56) // Checks if the length does not fit in this block.
+    {
+        adminSha256Block(state, block); // Processes this block.
+        memset(block, 0, sizeof(block)); // Starts a fresh block for the length.
+    }
+    unsigned long long bitLength = (unsigned long long)length * 8; // The message length in bits.
+    for (int i = 0; i < 8; i++) block[63 - i] = (unsigned char)(bitLength >> (i * 8)); // Stores it big-endian.
+    adminSha256Block(state, block); // Processes the last block.
+
+    for (int i = 0; i < 8; i++) // Writes the digest big-endian.
+    {
+        digest[i * 4] = (unsigned char)(state[i] >> 24); // Highest byte.
+        digest[i * 4 + 1] = (unsigned char)(state[i] >> 16); // Second byte.
+        digest[i * 4 + 2] = (unsigned char)(state[i] >> 8); // Third byte.
+        digest[i * 4 + 3] = (unsigned char)state[i]; // Lowest byte.
+    }
+}
+
+// A private helper function to write bytes as lowercase hexadecimal.
+static inline void adminToHex(const unsigned char *bytes, int length, char *out)
+{
+    static const char digits[] = "0123456789abcdef"; // The hexadecimal digits.
+    for (int i = 0; i < length; i++) // Walks the bytes.
+    {
+        out[i * 2] = digits[bytes[i] >> 4]; // Writes the high nibble.
+        out[i * 2 + 1] = digits[bytes[i] & 0x0f]; // Writes the low nibble.
+    }
+    out[length * 2] = '\0'; // Terminates the string.
+}
+
+// A private helper function to derive the salted, iterated hash of a password as hexadecimal.
+static inline void adminDeriveHash(const char *saltHex, const char *password, int iterations, char hashHexOut[ADMIN_HASH_BYTES * 2 + 1])
+{
+    unsigned char digest[32]; // The running digest.
+    size_t saltLength = strlen(saltHex), passwordLength = strlen(password); // The input lengths.
+    unsigned char *input = malloc(saltLength + passwordLength + 32); // Room for salt + password, or digest + password.
+    if (input == NULL) // Checks if memory ran out.
+    {
+        hashHexOut[0] = '\0'; // An empty hash never matches.
+        return; // Exits the function.
+    }
+    memcpy(input, saltHex, saltLength); // Starts with the salt.
+    memcpy(input + saltLength, password, passwordLength); // Appends the password.
+    adminSha256(input, saltLength + passwordLength, digest); // First round: SHA-256(salt || password).
+    for (int i = 1; i < iterations; i++) // Stretches the hash to slow down guessing.
+    {
+        memcpy(input, digest, 32); // Feeds back the previous digest.
+        memcpy(input + 32, password, passwordLength); // Mixes in the password again.
+        adminSha256(input, 32 + passwordLength, digest); // Next round: SHA-256(digest || password).
+    }
+    memset(input, 0, saltLength + passwordLength + 32); // Wipes the password copy.
+    free(input); // Frees the buffer.
+    adminToHex(digest, ADMIN_HASH_BYTES, hashHexOut); // Converts the stored part of the digest to hexadecimal.
+}
+
+// A private helper function to fill a buffer with random salt bytes.
+static inline void adminRandomSalt(unsigned char *salt, int length)
+{
+    FILE *source = fopen("/dev/urandom", "rb"); // Uses the system's random source where there is one.
+    if (source != NULL && fread(salt, 1, length, source) == (size_t)length) // Reads the salt.
+    {
+        fclose(source); // Closes the random source.
+        return; // The salt is ready.
+    }
+    if (source != NULL) fclose(source); // Closes a random source that came up short.
+    static int seeded = 0; // Tracks whether rand() has been seeded.
+    if (!seeded) // Seeds rand() once.
+    {
+        srand((unsigned int)time(NULL) ^ (unsigned int)clock() ^ (unsigned int)(size_t)salt); // Mixes time and an address.
+        seeded = 1; // Remembers the seeding.
+    }
+    for (int i = 0; i < length; i++) salt[i] = (unsigned char)(rand() & 0xff); // Falls back to rand().
+}
+
+// Hashes a password with a fresh salt into the 49-character stored form "$s1$<salt>$<hash>".
+static inline void hashAdminPassword(const char *password, char *credentialOut, size_t size)
+{
+    unsigned char salt[ADMIN_SALT_BYTES]; // The raw salt.
+    char saltHex[ADMIN_SALT_BYTES * 2 + 1]; // The salt as hexadecimal.
+    char hashHex[ADMIN_HASH_BYTES * 2 + 1]; // The hash as hexadecimal.
+    adminRandomSalt(salt, ADMIN_SALT_BYTES); // Picks a new salt.
+    adminToHex(salt, ADMIN_SALT_BYTES, saltHex); // Converts it to hexadecimal.
+    adminDeriveHash(saltHex, password, ADMIN_HASH_ITERATIONS, hashHex); // Derives the hash.
+    snprintf(credentialOut, size, "%s%s$%s", ADMIN_HASH_PREFIX, saltHex, hashHex); // Builds the stored form.
+}
+
+// A private helper function to compare two strings in time that depends only on their lengths, not their contents.
+static inline int adminConstantTimeEquals(const char *a, const char *b)
+{
+    size_t lengthA = strlen(a), lengthB = strlen(b); // The string lengths.
+    size_t length = lengthA > lengthB ? lengthA : lengthB; // Walks the longer of the two.
+    unsigned char difference = (unsigned char)(lengthA != lengthB); // Different lengths never match.
+    for (size_t i = 0; i < length; i++) // Compares every position without stopping early.
+    {
+        unsigned char x = i < lengthA ? (unsigned char)a[i] : 0; // A byte of the first string, or 0 past its end.
+        unsigned char y = i < lengthB ? (unsigned char)b[i] : 0; // A byte of the second string, or 0 past its end.
+        difference |= x ^ y; // Accumulates any difference.
+    }
+    return difference == 0; // Returns 1 only if every byte matched.
+}
+
+// Checks a password against a stored password field (a salted hash, or plaintext in an unmigrated file).
+static inline int checkAdminPassword(const char *credential, const char *password)
+{
+    size_t prefixLength = strlen(ADMIN_HASH_PREFIX); // The length of the hash marker.
+    if (strncmp(credential, ADMIN_HASH_PREFIX, prefixLength) != 0) // Checks for a legacy plaintext password.
+    {
+        return adminConstantTimeEquals(credential, password); // Compares plaintext without leaking timing.
+    }
+
+    char saltHex[ADMIN_SALT_BYTES * 2 + 1]; // The stored salt.
+    char storedHash[ADMIN_HASH_BYTES * 2 + 1]; // The stored hash.
+    char computedHash[ADMIN_HASH_BYTES * 2 + 1]; // The hash of the password being checked.
+    if (sscanf(credential + prefixLength, "%12[0-9a-f]$%32[0-9a-f]", saltHex, storedHash) != 2) // Parses the stored form.
+    {
+        saltHex[0] = '\0'; // A damaged hash still costs a full derivation and never matches.
+        storedHash[0] = '\0'; // Continues clearing.
+    }
+    adminDeriveHash(saltHex, password, ADMIN_HASH_ITERATIONS, computedHash); // Hashes the password the same way.
+    return adminConstantTimeEquals(storedHash, computedHash); // Compares the hashes without leaking timing.
+}
+
+// A private helper function to hash an admin ID to a bucket (FNV-1a).
+static inline unsigned int adminStoreBucket(const char *adminID)
+{
+    unsigned int hash = 2166136261u; // Starts from the FNV offset basis.
+    while (*adminID) hash = (hash ^ (unsigned char)*adminID++) * 16777619u; // Mixes in each character.
+    return hash & (adminStore.bucketCount - 1); // Masks to the bucket range.
+}
+
+// A private helper function to parse "adminID,...,...,...,...,password" into an ID and password field.
+static inline int adminParseLine(const char *line, char *adminIDOut, char *credentialOut)
+{
+    const char *field = line; // Walks to the sixth field.
+    for (int i = 0; i < 5; i++) // Skips the first five commas.
+    {
+        field = strchr(field, ','); // Finds the next comma.
+        if (field == NULL) return 0; // Lines with fewer than six fields are ignored.
+        field++; // Steps past the comma.
+    }
+    size_t idLength = strcspn(line, ","); // The length of the admin ID.
+    size_t credentialLength = strcspn(field, " \t\r\n"); // The password field ends at whitespace, as before.
+    if (idLength == 0 || idLength >= MAX_ID_LENGTH || credentialLength == 0 || credentialLength >= ADMIN_CREDENTIAL_LENGTH) return 0; // Rejects fields that do not fit.
+    memcpy(adminIDOut, line, idLength); // Copies the admin ID.
+    adminIDOut[idLength] = '\0'; // Terminates it.
+    memcpy(credentialOut, field, credentialLength); // Copies the password field.
+    credentialOut[credentialLength] = '\0'; // Terminates it.
+    return 1; // Returns 1 (success).
+}
+
+// Releases the cached admin index.
+static inline void adminStoreFree()
+{
+    for (unsigned int i = 0; i < adminStore.bucketCount; i++) // Walks the buckets.
+    {
+        AdminCredentialEntry *entry = adminStore.buckets[i]; // Starts at the bucket's first entry.
+        while (entry != NULL) // Walks the chain.
+        {
+            AdminCredentialEntry *next = entry->next; // Remembers the next entry.
+            memset(entry->credential, 0, sizeof(entry->credential)); // Wipes the stored password field.
+            free(entry); // Frees the entry.
+            entry = next; // Moves on.
+        }
+    }
+    free(adminStore.buckets); // Frees the bucket array.
+    adminStore.buckets = NULL; // Clears the pointer.
+    adminStore.bucketCount = adminStore.entryCount = 0; // Resets the counters.
+    adminStore.fileSize = adminStore.fileMtime = adminStore.loadedAt = -1; // Forces a reload next time.
+}
+
+// A private helper function to insert (or replace) one admin in the index, doubling the buckets when it gets crowded.
+static inline int adminStoreInsert(const char *adminID, const char *credential)
+{
+    if (adminStore.entryCount >= adminStore.bucketCount) // Keeps the load factor at or below one.
+    {
+        unsigned int newCount = adminStore.bucketCount * 2; // Doubles the bucket count.
+        AdminCredentialEntry **newBuckets = calloc(newCount, sizeof(AdminCredentialEntry *)); // Allocates the new buckets.
+        if (newBuckets == NULL) return 0; // Fails if memory ran out.
+        AdminCredentialEntry **oldBuckets = adminStore.buckets; // Keeps the old buckets to rehash.
+        unsigned int oldCount = adminStore.bucketCount; // Keeps the old size.
+        adminStore.buckets = newBuckets; // Installs the new buckets.
+        adminStore.bucketCount = newCount; // Records the new size.
+        for (unsigned int i = 0; i < oldCount; i++) // Moves every entry to its new bucket.
+        {
+            AdminCredentialEntry *entry = oldBuckets[i]; // Starts at the old bucket's first entry.
+            while (entry != NULL) // Walks the chain.
+            {
+                AdminCredentialEntry *next = entry->next; // Remembers the next entry.
+                unsigned int bucket = adminStoreBucket(entry->adminID); // Finds its new bucket.
+                entry->next = adminStore.buckets[bucket]; // Links it at the front.
+                adminStore.buckets[bucket] = entry; // Stores it.
+                entry = next; // Moves on.
+            }
+        }
+        free(oldBuckets); // Frees the old bucket array.
+    }
+
+    unsigned int bucket = adminStoreBucket(adminID); // Finds the bucket for this ID.
+    for (AdminCredentialEntry *entry = adminStore.buckets[bucket]; entry != NULL; entry = entry->next) // Looks for an existing entry.
+    {
+        if (strcmp(entry->adminID, adminID) == 0) // Checks for the same ID.
+        {
+            strcpy(entry->credential, credential); // The last line for an ID wins.
+            return 1; // Returns 1 (success).
+        }
+    }
+    AdminCredentialEntry *entry = malloc(sizeof(AdminCredentialEntry)); // Allocates a new entry.
+    if (entry == NULL) return 0; // Fails if memory ran out.
+    strcpy(entry->adminID, adminID); // Copies the admin ID.
+    strcpy(entry->credential, credential); // Copies the password field.
+    entry->next = adminStore.buckets[bucket]; // Links it at the front of the bucket.
+    adminStore.buckets[bucket] = entry; // Stores it.
+    adminStore.entryCount++; // Counts it.
+    return 1; // Returns 1 (success).
+}
+
+// A private helper function to (re)build the index when the admin file is new or has changed since it was loaded.
+static inline int adminStoreRefresh(const char *adminFilePath)
+{
+    struct stat info; // Holds the file's size and modification time.
+    if (stat(adminFilePath, &info) != 0) return 0; // Fails if the file is missing.
+    // Same size and mtime is trusted only if the mtime is older than the load, so an edit in the same second is never missed.
+    if (adminStore.buckets != NULL && strcmp(adminStore.path, adminFilePath) == 0 && adminStore.fileSize == (long long)info.st_size &&
+        adminStore.fileMtime == (long long)info.st_mtime && adminStore.fileMtime < adminStore.loadedAt) // Checks if the cache is current.
+    {
+        return 1; // The cached index is still valid.
+    }
+
+    long long loadedAt = (long long)time(NULL); // Notes the load time before reading, so a write during the read forces a reload.
+    FILE *file = fopen(adminFilePath, "r"); // Opens the admin file.
+    if (file == NULL) return 0; // Fails if it cannot be read.
+    adminStoreFree(); // Drops the stale index.
+    adminStore.buckets = calloc(ADMIN_STORE_INITIAL_BUCKETS, sizeof(AdminCredentialEntry *)); // Allocates the buckets.
+    if (adminStore.buckets == NULL) // Checks if memory ran out.
+    {
+        fclose(file); // Closes the file.
+        return 0; // Returns 0 (failure).
+    }
+    adminStore.bucketCount = ADMIN_STORE_INITIAL_BUCKETS; // Records the bucket count.
+
+    char line[512]; // A buffer for each admin record.
+    char adminID[MAX_ID_LENGTH]; // The parsed admin ID.
+    char credential[ADMIN_CREDENTIAL_LENGTH]; // The parsed password field.
+    while (fgets(line, sizeof(line), file)) // Reads the file line by line.
+    {
+        if (adminParseLine(line, adminID, credential)) adminStoreInsert(adminID, credential); // Indexes each valid record.
+    }
+    fclose(file); // Closes the file.
+    snprintf(adminStore.path, sizeof(adminStore.path), "%s", adminFilePath); // Remembers which file was loaded.
+    adminStore.fileSize = (long long)info.st_size; // Remembers its size.
+    adminStore.fileMtime = (long long)info.st_mtime; // Remembers its modification time.
+    adminStore.loadedAt = loadedAt; // Remembers when it was loaded.
+    return 1; // Returns 1 (success).
+}
+
+// A private helper function to rewrite every plaintext password in the admin file as a salted hash, through a temporary file.
+// Returns the number of passwords hashed, or -1 on failure; on failure the admin file is left as it was.
+static inline int adminHashPlaintextEntries(const char *adminFilePath)
+{
+    FILE *input = fopen(adminFilePath, "r"); // Opens the admin file.
+    if (input == NULL) // Checks if the file failed to open.
+    {
+        printf("Error: Could not open admin file '%s'.\n", adminFilePath); // Prints an error message.
+        return -1; // Returns -1 (failure).
+    }
+    char tempPath[300]; // A buffer for the temporary file name.
+    snprintf(tempPath, sizeof(tempPath), "%s.tmp", adminFilePath); // Names the rewritten file.
+    FILE *output = fopen(tempPath, "w"); // Opens the rewritten file.
+    if (output == NULL) // Checks if it failed to open.
+    {
+        printf("Error: Could not write next to '%s'.\n", adminFilePath); // Prints an error message.
+        fclose(input); // Closes the admin file.
+        return -1; // Returns -1 (failure).
+    }
+
+    int migrated = 0; // Counts the passwords hashed.
+    char line[512]; // A buffer for each admin record.
+    char adminID[MAX_ID_LENGTH]; // The parsed admin ID.
+    char credential[ADMIN_CREDENTIAL_LENGTH]; // The parsed password field.
+    while (fgets(line, sizeof(line), input)) // Reads the file line by line.
+    {
+        if (!adminParseLine(line, adminID, credential) || strncmp(credential, ADMIN_HASH_PREFIX, strlen(ADMIN_HASH_PREFIX)) == 0) // Leaves other lines and hashed passwords alone.
+        {
+            fputs(line, output); // Copies the line unchanged.
+            continue; // Moves on.
+        }
+        char hashed[ADMIN_CREDENTIAL_LENGTH]; // The new password field.
+        hashAdminPassword(credential, hashed, sizeof(hashed)); // Hashes the plaintext password.
+        const char *field = line; // Walks to the password field.
+        for (int i = 0; i < 5; i++) field = strchr(field, ',') + 1; // Skips the first five fields (checked by adminParseLine).
+        fprintf(output, "%.*s%s\n", (int)(field - line), line, hashed); // Writes the first five fields and the hash.
+        memset(credential, 0, sizeof(credential)); // Wipes the plaintext copy.
+        migrated++; // Counts the migration.
+    }
+    memset(line, 0, sizeof(line)); // Wipes the last plaintext line.
+    int failed = ferror(input) || ferror(output); // Checks for read and write errors.
+    fclose(input); // Closes the admin file.
+    if (fclose(output) != 0) failed = 1; // Checks that the rewritten file reached the disk.
+    if (failed) // Never replaces the admin file with a partial copy.
+    {
+        printf("Error: Could not write the migrated copy of '%s'; nothing was changed.\n", adminFilePath); // Prints an error message.
+        remove(tempPath); // Cleans up the partial copy.
+        return -1; // Returns -1 (failure).
+    }
+
+#ifdef _WIN32
+    remove(adminFilePath); // Windows rename will not overwrite; POSIX rename replaces the file in one step.
+#endif
+    if (rename(tempPath, adminFilePath) != 0) // Moves the rewritten file into place.
+    {
+        printf("Error: Could not replace '%s'; the migrated copy is in '%s'.\n", adminFilePath, tempPath); // Points the user at the new file.
+        return -1; // Returns -1 (failure).
+    }
+    return migrated; // Returns how many passwords were hashed.
+}
+
+// Verifies an admin login with one hash lookup; the index is only rebuilt when the admin file changes.
+// Returns 1 if the credentials match, 0 otherwise.
+static inline int adminStoreVerify(const char *adminFilePath, const char *adminID, const char *password)
+{
+    if (!adminStoreRefresh(adminFilePath)) // Makes sure the index reflects the file.
+    {
+        printf("Critical Error: Cannot open admin file for verification.\n"); // Prints a critical error message.
+        return 0; // Returns 0 to indicate failure.
+    }
+    for (AdminCredentialEntry *entry = adminStore.buckets[adminStoreBucket(adminID)]; entry != NULL; entry = entry->next) // Walks the one bucket for this ID.
+    {
+        if (strcmp(entry->adminID, adminID) != 0) continue; // Skips other admins in the same bucket.
+        return checkAdminPassword(entry->credential, password); // Returns 1 only if the password matches; the file is never written here.
+    }
+    char decoy[ADMIN_CREDENTIAL_LENGTH]; // A hash in the stored form, checked for unknown IDs.
+    snprintf(decoy, sizeof(decoy), "%s00$00", ADMIN_HASH_PREFIX); // A hash that never matches but costs the same rounds.
+    checkAdminPassword(decoy, password); // Does the same work for unknown IDs so they cannot be told apart by timing.
+    return 0; // Returns 0 because no admin has that ID.
+}
+
+// Rewrites the admin file so every plaintext password becomes a salted hash. No plaintext copy is left behind.
+// Logins never write the admin file, so run this (Main --migrate-admins) once with no operators logged in.
+// Returns the number of passwords migrated, or -1 on failure.
+static inline int migrateAdminFile(const char *adminFilePath)
+{
+    int migrated = adminHashPlaintextEntries(adminFilePath); // Hashes every plaintext password.
+    adminStoreFree(); // Forces the index to reload from the migrated file.
+    return migrated; // Returns how many passwords were hashed.
+}
+
+#endif // Marks the end of the ADMIN_CREDENTIAL_STORE_H header guard.
@@ -0,0 +1,701 @@
+#ifndef BACKUP_MANAGEMENT_H // If BACKUP_MANAGEMENT_H is not defined,
+#define BACKUP_MANAGEMENT_H // Define BACKUP_MANAGEMENT_H to prevent multiple inclusions.
+
+#include <stdio.h> // Includes standard input/output functions.
+#include <string.h> // Includes string handling functions.
+#include <stdlib.h> // Includes standard library functions like malloc, qsort and bsearch.
+#include <time.h> // Includes time functions used to stamp manifests.
+#include <sys/stat.h> // Includes stat() to detect files that have not changed.
+
+#ifdef _WIN32 // If compiling on Windows,
+#include <direct.h> // Includes _mkdir for creating directories.
+#include <io.h> // Includes _open and _close for the lock file.
+#include <fcntl.h> // Includes the _open flags.
+#include <sys/locking.h> // Includes _locking for the lock file.
+#define backupMkdir(path) _mkdir(path) // Maps directory creation to the Windows call.
+#else // On POSIX systems,
+#include <fcntl.h> // Includes open for the lock file.
+#include <unistd.h> // Includes close for the lock file.
+#include <sys/file.h> // Includes flock for the lock file.
+#define backupMkdir(path) mkdir(path, 0755) // Maps directory creation to the POSIX call.
+#endif
+
+#define BACKUP_DIR "backup" // Defines the default directory that holds full backups and delta bundles.
+#define REPLICA_DIR "replica" // Defines the default directory kept up to date as a warm replica.
+#define BACKUP_STATE_FILE "backup_state.txt" // Defines the file recording the backup generation and last delta number.
+#define REPLICA_STATE_FILE "replica_state.txt" // Defines the file recording which deltas a replica has applied.
+#define BACKUP_LOCK_FILE "backup.lock" // Defines the lock file that lets only one process at a time change a backup directory.
+#define BACKUP_LINE_LENGTH 1024 // Defines the longest record line the backup code handles.
+#define BACKUP_KEY_LENGTH 64 // Defines the longest record key (the first field of a line).
+#define BACKUP_PATH_LENGTH 512 // Defines the longest path built by the backup code.
+
+// The data files covered by every backup, in the order they are written to a delta bundle.
+static const char *const BACKUP_DATA_FILES[] = {"admins.txt", "inventory.txt", "categories.txt", "suppliers.txt", "customers.txt", "transactions.txt", "reorder_thresholds.txt"};
+#define BACKUP_DATA_FILE_COUNT ((int)(sizeof(BACKUP_DATA_FILES) / sizeof(BACKUP_DATA_FILES[0]))) // Counts the data files above.
+
+// One record remembered by a manifest: its key and a hash of the full line.
+typedef struct
+{
+    char key[BACKUP_KEY_LENGTH]; // The first field of the record (e.g. the product ID).
+    unsigned long long hash; // A hash of the whole line, used to spot edits.
+    int seen; // Set while scanning to find records that were deleted.
+} BackupManifestEntry;
+
+// A growable list of record lines loaded from a data file.
+typedef struct
+{
+    char **lines; // The record lines, without trailing newlines.
+    int count; // The number of lines in use.
+    int capacity; // The number of lines allocated.
+} BackupRecordList;
+
+// A private helper function to build "dir/name" into a buffer.
+static inline void backupJoinPath(char *out, size_t size, const char *dir, const char *name)
+{
+    snprintf(out, size, "%s/%s", dir, name); // Forward slashes work for fopen on every supported platform.
+}
+
+// A private helper function to create a directory, treating "already exists" as success.
+static inline int backupEnsureDirectory(const char *dir)
+{
+    struct stat info; // Holds the result of checking the path.
+    if (stat(dir, &info) == 0) // Checks if something already exists at the path.
+    {
+        return (info.st_mode & S_IFDIR) != 0; // Succeeds only if it is a directory.
+    }
+    return backupMkdir(dir) == 0; // Creates the directory and reports whether that worked.
+}
+
+// A private helper function to compute a 64-bit FNV-1a hash of a record line.
+static inline unsigned long long backupHashLine(const char *line)
+{
+    unsigned long long hash = 14695981039346656037ULL; // Starts from the FNV offset basis.
+    while (*line) // Walks every character of the line.
+    {
+        hash ^= (unsigned char)*line++; // Mixes in the next byte.
+        hash *= 1099511628211ULL; // Multiplies by the FNV prime.
+    }
+    return hash; // Returns the finished hash.
+}
+
+// A private helper function to copy the key (everything before the first comma) of a record line.
+static inline void backupRecordKey(const char *line, char *keyOut, size_t size)
+{
+    size_t length = strcspn(line, ","); // Finds the end of the first field.
+    if (length >= size) length = size - 1; // Truncates keys that are too long for the buffer.
+    memcpy(keyOut, line, length); // Copies the key characters.
+    keyOut[length] = '\0'; // Terminates the key string.
+}
+
+// A private helper function to strip a trailing newline (and carriage return) from a line.
+static inline void backupTrimLine(char *line)
+{
+    line[strcspn(line, "\r\n")] = '\0'; // Cuts the line at the first line-ending character.
+}
+
+// A private helper function to append a copy of a line to a record list.
+static inline int backupListAppend(BackupRecordList *list, const char *line)
+{
+    if (list->count == list->capacity) // Checks if the list is full.
+    {
+        int newCapacity = list->capacity ? list->capacity * 2 : 64; // Doubles the capacity (or starts at 64).
+        char **grown = realloc(list->lines, newCapacity * sizeof(char *)); // Grows the array of line pointers.
+        if (grown == NULL) return 0; // Fails if memory could not be allocated.
+        list->lines = grown; // Stores the grown array.
+        list->capacity = newCapacity; // Records the new capacity.
+    }
+    char *copy = malloc(strlen(line) + 1); // Allocates space for the line.
+    if (copy == NULL) return 0; // Fails if memory could not be allocated.
+    strcpy(copy, line); // Copies the line.
+    list->lines[list->count++] = copy; // Stores the line at the end of the list.
+    return 1; // Returns 1 (success).
+}
+
+// A private helper function to release every line held by a record list.
+static inline void backupListFree(BackupRecordList *list)
+{
+    for (int i = 0; i < list->count; i++) free(list->lines[i]); // Frees each line.
+    free(list->lines); // Frees the array of pointers.
+    list->lines = NULL; // Clears the pointer so the list can be reused.
+    list->count = list->capacity = 0; // Resets the counters.
+}
+
+// A private helper function to load every non-empty line of a file into a record list.
+static inline int backupListLoad(const char *path, BackupRecordList *list)
+{
+    FILE *file = fopen(path, "r"); // Opens the file in read mode.
+    if (file == NULL) return 1; // A missing file is treated as an empty one.
+    char line[BACKUP_LINE_LENGTH]; // A buffer for each line.
+    while (fgets(line, sizeof(line), file)) // Reads the file line by line.
+    {
+        backupTrimLine(line); // Removes the newline.
+        if (line[0] == '\0') continue; // Skips blank lines.
+        if (!backupListAppend(list, line)) // Adds the line to the list.
+        {
+            fclose(file); // Closes the file before failing.
+            return 0; // Returns 0 (failure) if memory ran out.
+        }
+    }
+    fclose(file); // Closes the file.
+    return 1; // Returns 1 (success).
+}
+
+// A private helper function to find the index of the record with a given key, or -1.
+static inline int backupListFind(const BackupRecordList *list, const char *key)
+{
+    char lineKey[BACKUP_KEY_LENGTH]; // A buffer for each line's key.
+    for (int i = 0; i < list->count; i++) // Walks the list.
+    {
+        backupRecordKey(list->lines[i], lineKey, sizeof(lineKey)); // Extracts the key of the line.
+        if (strcmp(lineKey, key) == 0) return i; // Returns the index on a match.
+    }
+    return -1; // Returns -1 if no record has that key.
+}
+
+// A private helper function to close a finished temporary file and move it over path.
+// Nothing is replaced unless every write reached the file. On POSIX, rename swaps the file in one step, so path always exists.
+static inline int backupCommitTempFile(FILE *file, const char *tempPath, const char *path)
+{
+    int ok = !ferror(file); // Checks that every write succeeded.
+    if (fclose(file) != 0) ok = 0; // Checks that the data reached the file.
+#ifdef _WIN32
+    if (ok) remove(path); // Windows rename will not overwrite an existing file.
+#endif
+    if (ok && rename(tempPath, path) == 0) return 1; // Moves the new file into place.
+    remove(tempPath); // Cleans up the temporary file; the old file is untouched.
+    return 0; // Returns 0 (failure).
+}
+
+// A private helper function to write a record list to a file via a temporary file and rename.
+static inline int backupListWrite(const char *path, const BackupRecordList *list)
+{
+    char tempPath[BACKUP_PATH_LENGTH]; // A buffer for the temporary file name.
+    snprintf(tempPath, sizeof(tempPath), "%s.tmp", path); // Builds the temporary file name.
+    FILE *file = fopen(tempPath, "w"); // Opens the temporary file for writing.
+    if (file == NULL) return 0; // Fails if the file could not be created.
+    for (int i = 0; i < list->count; i++) fprintf(file, "%s\n", list->lines[i]); // Writes each record on its own line.
+    return backupCommitTempFile(file, tempPath, path); // Replaces the old file.
+}
+
+// A private helper function to copy a file byte for byte; a missing source produces an empty copy.
+static inline int backupCopyFile(const char *sourcePath, const char *destinationPath)
+{
+    FILE *destination = fopen(destinationPath, "wb"); // Opens the destination for writing.
+    if (destination == NULL) return 0; // Fails if the destination could not be created.
+    FILE *source = fopen(sourcePath, "rb"); // Opens the source for reading.
+    if (source != NULL) // Copies only if the source exists.
+    {
+        char buffer[4096]; // A buffer for chunks of the file.
+        size_t bytesRead; // The number of bytes in the current chunk.
+        while ((bytesRead = fread(buffer, 1, sizeof(buffer), source)) > 0) // Reads the source chunk by chunk.
+        {
+            fwrite(buffer, 1, bytesRead, destination); // Writes each chunk to the destination.
+        }
+        fclose(source); // Closes the source.
+    }
+    int ok = !ferror(destination); // Checks that every chunk was written.
+    return (fclose(destination) == 0) && ok; // Returns 1 only if the copy is complete on disk.
+}
+
+// A private helper function to read the backup generation and last delta number of a state file.
+static inline int backupReadState(const char *statePath, int *generation, int *sequence)
+{
+    FILE *file = fopen(statePath, "r"); // Opens the state file.
+    if (file == NULL) return 0; // Returns 0 if there is no state yet.
+    int ok = fscanf(file, "%d,%d", generation, sequence) == 2; // Parses "generation,sequence".
+    fclose(file); // Closes the file.
+    return ok; // Returns whether both numbers were read.
+}
+
+// A private helper function to write a generation and delta number to a state file.
+// The state file is the commit point of every backup, so it is replaced through a temporary file.
+static inline int backupWriteState(const char *statePath, int generation, int sequence)
+{
+    char tempPath[BACKUP_PATH_LENGTH]; // A buffer for the temporary file name.
+    snprintf(tempPath, sizeof(tempPath), "%s.tmp", statePath); // Builds the temporary file name.
+    FILE *file = fopen(tempPath, "w"); // Opens the temporary file for writing.
+    if (file == NULL) return 0; // Fails if the file could not be written.
+    fprintf(file, "%d,%d\n", generation, sequence); // Writes "generation,sequence".
+    return backupCommitTempFile(file, tempPath, statePath); // Replaces the old state.
+}
+
+// A private helper function to build the path of a file belonging to one backup generation.
+// Full copies, manifests and bundles are all named per generation, so a new full backup never touches the files the current state points at.
+static inline void backupGenerationPath(char *out, size_t size, const char *backupDir, int generation, const char *name)
+{
+    snprintf(out, size, "%s/g%06d_%s", backupDir, generation, name); // Prefixes the name with the generation.
+}
+
+// A private helper function to build the path of delta bundle number `sequence` of a generation.
+static inline void backupBundlePath(char *out, size_t size, const char *backupDir, int generation, int sequence)
+{
+    snprintf(out, size, "%s/g%06d_delta_%06d.txt", backupDir, generation, sequence); // Zero-pads so bundles sort in order.
+}
+
+// A private helper function used by qsort and bsearch to order manifest entries by key.
+static inline int backupCompareManifestEntries(const void *a, const void *b)
+{
+    return strcmp(((const BackupManifestEntry *)a)->key, ((const BackupManifestEntry *)b)->key); // Compares the keys.
+}
+
+// A private helper function to load a manifest; it also returns the stat line saved with it.
+static inline BackupManifestEntry *backupLoadManifest(const char *manifestPath, int *countOut, long long *sizeOut, long long *mtimeOut, long long *writtenOut)
+{
+    *countOut = 0; // Starts with no entries.
+    *sizeOut = *mtimeOut = *writtenOut = -1; // Marks the stat line as unknown.
+    FILE *file = fopen(manifestPath, "r"); // Opens the manifest.
+    if (file == NULL) return NULL; // A missing manifest means no records are known.
+
+    BackupManifestEntry *entries = NULL; // The growing array of entries.
+    int capacity = 0; // The allocated size of the array.
+    char line[BACKUP_LINE_LENGTH]; // A buffer for each manifest line.
+    while (fgets(line, sizeof(line), file)) // Reads the manifest line by line.
+    {
+        if (line[0] == '#') // The "#stat" line describes the data file when the manifest was written.
+        {
+            sscanf(line, "#stat %lld %lld %lld", sizeOut, mtimeOut, writtenOut); // Reads size, mtime and write time.
+            continue; // Moves on to the entries.
+        }
+        if (*countOut == capacity) // Checks if the array is full.
+        {
+            capacity = capacity ? capacity * 2 : 64; // Doubles the capacity.
+            BackupManifestEntry *grown = realloc(entries, capacity * sizeof(BackupManifestEntry)); // Grows the array.
+            if (grown == NULL) break; // Stops reading if memory ran out.
+            entries = grown; // Stores the grown array.
+        }
+        BackupManifestEntry *entry = &entries[*countOut]; // Points at the next free slot.
+        char *comma = strrchr(line, ','); // The hash is after the last comma.
+        if (comma == NULL) continue; // Skips malformed lines.
+        *comma = '\0'; // Splits the key from the hash.
+        backupRecordKey(line, entry->key, sizeof(entry->key)); // Copies the key.
+        entry->hash = strtoull(comma + 1, NULL, 16); // Parses the hexadecimal hash.
+        entry->seen = 0; // Marks the entry as not yet seen.
+        (*countOut)++; // Counts the entry.
+    }
+    fclose(file); // Closes the manifest.
+    if (entries != NULL) qsort(entries, *countOut, sizeof(BackupManifestEntry), backupCompareManifestEntries); // Sorts for binary search.
+    return entries; // Returns the entries (caller frees).
+}
+
+// A private helper function to write the manifest of a data file: its stat line and a key/hash per record.
+static inline int backupWriteManifest(const char *dataPath, const char *manifestPath)
+{
+    FILE *data = fopen(dataPath, "r"); // Opens the data file (it may not exist yet).
+    char tempPath[BACKUP_PATH_LENGTH]; // A buffer for the temporary manifest name.
+    snprintf(tempPath, sizeof(tempPath), "%s.tmp", manifestPath); // Builds the temporary name.
+    FILE *manifest = fopen(tempPath, "w"); // Opens the temporary manifest.
+    if (manifest == NULL) // Checks if the manifest could not be created.
+    {
+        if (data) fclose(data); // Closes the data file before failing.
+        return 0; // Returns 0 (failure).
+    }
+
+    struct stat info; // Holds the data file's size and modification time.
+    if (stat(dataPath, &info) == 0) // Records the stat line only if the file exists.
+    {
+        fprintf(manifest, "#stat %lld %lld %lld\n", (long long)info.st_size, (long long)info.st_mtime, (long long)time(NULL)); // Writes size, mtime and now.
+    }
+    if (data != NULL) // Lists the records only if the data file exists.
+    {
+        char line[BACKUP_LINE_LENGTH]; // A buffer for each record.
+        char key[BACKUP_KEY_LENGTH]; // A buffer for each record's key.
+        while (fgets(line, sizeof(line), data)) // Reads the data file line by line.
+        {
+            backupTrimLine(line); // Removes the newline.
+            if (line[0] == '\0') continue; // Skips blank lines.
+            backupRecordKey(line, key, sizeof(key)); // Extracts the key.
+            fprintf(manifest, "%s,%llx\n", key, backupHashLine(line)); // Writes "key,hash".
+        }
+        fclose(data); // Closes the data file.
+    }
+    return backupCommitTempFile(manifest, tempPath, manifestPath); // Replaces the old manifest.
+}
+
+// A private helper function to tell whether a data file is unchanged since its manifest was written.
+static inline int backupFileUnchanged(const char *dataPath, long long size, long long mtime, long long written)
+{
+    struct stat info; // Holds the current size and modification time.
+    if (stat(dataPath, &info) != 0) return size < 0; // A missing file is unchanged only if it was missing before.
+    // Same size and mtime is trusted only if the mtime is older than the manifest, so a same-second edit is never missed.
+    return (long long)info.st_size == size && (long long)info.st_mtime == mtime && mtime < written;
+}
+
+// The open lock file and how many nested calls hold it; the backup functions call each other, so the lock is re-entrant.
+static int backupLockHandle = -1;
+static int backupLockDepth = 0;
+
+// A private helper function to take the lock on backupDir, waiting for another process to finish if wait is set.
+// Every function that changes backupDir or a replica holds it, so two operators never pick the same bundle number.
+// Returns 1 if the lock is held, 0 if it is busy or cannot be created.
+static inline int backupLockAcquire(const char *backupDir, int wait)
+{
+    if (backupLockDepth > 0) // Checks if this process already holds it.
+    {
+        backupLockDepth++; // Counts the nested call.
+        return 1; // Returns 1 (success).
+    }
+    if (!backupEnsureDirectory(backupDir)) return 0; // The lock file lives in the backup directory.
+    char path[BACKUP_PATH_LENGTH]; // A buffer for the lock file path.
+    backupJoinPath(path, sizeof(path), backupDir, BACKUP_LOCK_FILE); // Builds the lock file path.
+#ifdef _WIN32
+    int handle = _open(path, _O_RDWR | _O_CREAT, _S_IREAD | _S_IWRITE); // Opens (or creates) the lock file.
+    if (handle >= 0 && _locking(handle, wait ? _LK_LOCK : _LK_NBLCK, 1) != 0) // Locks its first byte (_LK_LOCK retries for about 10 seconds).
+#else
+    int handle = open(path, O_RDWR | O_CREAT, 0644); // Opens (or creates) the lock file.
+    if (handle >= 0 && flock(handle, wait ? LOCK_EX : LOCK_EX | LOCK_NB) != 0) // Locks it; the system releases it if the process dies.
+#endif
+    {
+        close(handle); // Gives up the file.
+        handle = -1; // Marks the lock as not taken.
+    }
+    if (handle < 0) return 0; // Fails if the lock is busy or the file could not be opened.
+    backupLockHandle = handle; // Remembers the lock file.
+    backupLockDepth = 1; // Marks the lock as held.
+    return 1; // Returns 1 (success).
+}
+
+// A private helper function to release one hold on the backup lock.
+static inline void backupLockRelease()
+{
+    if (backupLockDepth == 0 || --backupLockDepth > 0) return; // Keeps the lock until the outermost call finishes.
+#ifdef _WIN32
+    _locking(backupLockHandle, _LK_UNLCK, 1); // Unlocks the first byte.
+#endif
+    close(backupLockHandle); // Closing the file releases the lock.
+    backupLockHandle = -1; // Forgets the lock file.
+}
+
+// A private helper function that does the full backup; the caller holds the backup lock.
+static inline int backupFullLocked(const char *dataDir, const char *backupDir)
+{
+    if (!backupEnsureDirectory(backupDir)) // Makes sure the backup directory exists.
+    {
+        printf("Error: Could not create backup directory '%s'.\n", backupDir); // Prints an error message.
+        return 0; // Returns 0 (failure).
+    }
+
+    char statePath[BACKUP_PATH_LENGTH]; // A buffer for the state file path.
+    backupJoinPath(statePath, sizeof(statePath), backupDir, BACKUP_STATE_FILE); // Builds the state file path.
+    int generation = 0, sequence = 0; // The previous generation and delta count.
+    int hadState = backupReadState(statePath, &generation, &sequence); // Reads the previous state, if any.
+
+    char path[BACKUP_PATH_LENGTH], name[BACKUP_PATH_LENGTH]; // Buffers for paths and derived file names.
+    for (int i = 0; i < BACKUP_DATA_FILE_COUNT; i++) // Walks every data file.
+    {
+        char dataPath[BACKUP_PATH_LENGTH]; // A buffer for the data file path.
+        backupJoinPath(dataPath, sizeof(dataPath), dataDir, BACKUP_DATA_FILES[i]); // Builds the data file path.
+        snprintf(name, sizeof(name), "full_%s", BACKUP_DATA_FILES[i]); // Names the full copy.
+        backupGenerationPath(path, sizeof(path), backupDir, generation + 1, name); // Places it in the new generation.
+        if (!backupCopyFile(dataPath, path)) return 0; // Copies the data file; the old generation is untouched on failure.
+        snprintf(name, sizeof(name), "%s.manifest", BACKUP_DATA_FILES[i]); // Names the manifest.
+        backupGenerationPath(path, sizeof(path), backupDir, generation + 1, name); // Places it in the new generation.
+        if (!backupWriteManifest(dataPath, path)) return 0; // Records which records the full copy holds.
+    }
+
+    if (!backupWriteState(statePath, generation + 1, 0)) return 0; // Commits the new generation with no deltas.
+    if (!hadState) return 1; // There is no older generation to clean up.
+
+    for (int i = 0; i < BACKUP_DATA_FILE_COUNT; i++) // Walks the old generation's files.
+    {
+        snprintf(name, sizeof(name), "full_%s", BACKUP_DATA_FILES[i]); // Names the old full copy.
+        backupGenerationPath(path, sizeof(path), backupDir, generation, name); // Builds its path.
+        remove(path); // Deletes it; the new full backup supersedes it.
+        snprintf(name, sizeof(name), "%s.manifest", BACKUP_DATA_FILES[i]); // Names the old manifest.
+        backupGenerationPath(path, sizeof(path), backupDir, generation, name); // Builds its path.
+        remove(path); // Deletes it.
+    }
+    for (int i = 1; i <= sequence; i++) // Walks the deltas of the old chain.
+    {
+        backupBundlePath(path, sizeof(path), backupDir, generation, i); // Builds each bundle path.
+        remove(path); // Deletes it.
+    }
+    return 1; // Returns 1 (success).
+}
+
+// Takes a full backup of every data file in dataDir into backupDir and starts a new delta chain.
+// The new generation's files are written first, the state file then switches to it, and only then is the old
+// generation removed, so a failure at any point leaves a backup that still restores. Returns 1 on success, 0 on failure.
+static inline int performFullBackup(const char *dataDir, const char *backupDir)
+{
+    if (!backupLockAcquire(backupDir, 1)) // Waits for any other process working on the backup.
+    {
+        printf("Error: Could not lock backup directory '%s'.\n", backupDir); // Prints an error message.
+        return 0; // Returns 0 (failure).
+    }
+    int result = backupFullLocked(dataDir, backupDir); // Does the work while holding the lock.
+    backupLockRelease(); // Lets other processes back in.
+    return result; // Returns what the work returned.
+}
+
+// A private helper function that does the incremental backup; the caller holds the backup lock.
+static inline int backupIncrementalLocked(const char *dataDir, const char *backupDir)
+{
+    char statePath[BACKUP_PATH_LENGTH]; // A buffer for the state file path.
+    backupJoinPath(statePath, sizeof(statePath), backupDir, BACKUP_STATE_FILE); // Builds the state file path.
+    int generation, sequence; // The current generation and last delta number.
+    if (!backupReadState(statePath, &generation, &sequence)) // Checks if a full backup exists.
+    {
+        return performFullBackup(dataDir, backupDir) ? 0 : -1; // Takes the first full backup instead.
+    }
+
+    char bundlePath[BACKUP_PATH_LENGTH]; // A buffer for the new bundle path.
+    backupBundlePath(bundlePath, sizeof(bundlePath), backupDir, generation, sequence + 1); // Names the next bundle.
+    FILE *bundle = NULL; // The bundle is only created once a change is found.
+    int changedRecords = 0; // Counts the records written to the bundle.
+    int changedFiles[BACKUP_DATA_FILE_COUNT]; // Remembers which manifests must be rewritten.
+
+    for (int i = 0; i < BACKUP_DATA_FILE_COUNT; i++) // Walks every data file.
+    {
+        changedFiles[i] = 0; // Assumes the file is unchanged.
+        char dataPath[BACKUP_PATH_LENGTH], manifestPath[BACKUP_PATH_LENGTH], name[BACKUP_PATH_LENGTH]; // Path buffers.
+        backupJoinPath(dataPath, sizeof(dataPath), dataDir, BACKUP_DATA_FILES[i]); // Builds the data file path.
+        snprintf(name, sizeof(name), "%s.manifest", BACKUP_DATA_FILES[i]); // Names the manifest.
+        backupGenerationPath(manifestPath, sizeof(manifestPath), backupDir, generation, name); // Builds the manifest path.
+
+        int entryCount; // The number of records in the manifest.
+        long long size, mtime, written; // The stat line of the manifest.
+        BackupManifestEntry *entries = backupLoadManifest(manifestPath, &entryCount, &size, &mtime, &written); // Loads the manifest.
+        if (backupFileUnchanged(dataPath, size, mtime, written)) // Skips files that have not been touched.
+        {
+            free(entries); // Frees the manifest.
+            continue; // Moves on to the next file.
+        }
+
+        int headerWritten = 0; // Tracks whether this file's section header is in the bundle.
+        FILE *data = fopen(dataPath, "r"); // Opens the data file.
+        char line[BACKUP_LINE_LENGTH]; // A buffer for each record.
+        while (data != NULL && fgets(line, sizeof(line), data)) // Reads the data file line by line.
+        {
+            backupTrimLine(line); // Removes the newline.
+            if (line[0] == '\0') continue; // Skips blank lines.
+            BackupManifestEntry probe; // A search key for the manifest.
+            backupRecordKey(line, probe.key, sizeof(probe.key)); // Extracts the record's key.
+            BackupManifestEntry *known = entries ? bsearch(&probe, entries, entryCount, sizeof(BackupManifestEntry), backupCompareManifestEntries) : NULL; // Looks the record up.
+            if (known != NULL) known->seen = 1; // Marks the record as still present.
+            if (known != NULL && known->hash == backupHashLine(line)) continue; // Skips records that have not changed.
+
+            if (bundle == NULL && (bundle = fopen(bundlePath, "w")) == NULL) // Creates the bundle on the first change.
+            {
+                fclose(data); // Closes the data file before failing.
+                free(entries); // Frees the manifest.
+                return -1; // Returns -1 (failure).
+            }
+            if (!headerWritten) fprintf(bundle, "@%s\n", BACKUP_DATA_FILES[i]); // Starts this file's section.
+            headerWritten = 1; // Remembers that the section has started.
+            fprintf(bundle, "+%s\n", line); // Writes the new or edited record.
+            changedRecords++; // Counts the change.
+        }
+        if (data != NULL) fclose(data); // Closes the data file.
+
+        for (int j = 0; j < entryCount; j++) // Walks the manifest for records that disappeared.
+        {
+            if (entries[j].seen) continue; // Skips records that are still present.
+            if (bundle == NULL && (bundle = fopen(bundlePath, "w")) == NULL) // Creates the bundle on the first change.
+            {
+                free(entries); // Frees the manifest.
+                return -1; // Returns -1 (failure).
+            }
+            if (!headerWritten) fprintf(bundle, "@%s\n", BACKUP_DATA_FILES[i]); // Starts this file's section.
+            headerWritten = 1; // Remembers that the section has started.
+            fprintf(bundle, "-%s\n", entries[j].key); // Writes the deletion.
+            changedRecords++; // Counts the change.
+        }
+        free(entries); // Frees the manifest.
+        changedFiles[i] = 1; // Refreshes this manifest even if only its stat line moved.
+    }
+
+    // Commits in the order bundle, state, manifests: a crash before the state write leaves the bundle number free and the
+    // manifests unchanged, so the next run writes the same changes again; a crash after it only re-emits changes that are
+    // already in this bundle, and re-applying a record is harmless.
+    if (bundle != NULL && fclose(bundle) != 0) return -1; // Closes the bundle, failing if it did not reach the disk.
+    if (changedRecords > 0 && !backupWriteState(statePath, generation, sequence + 1)) return -1; // Commits the new bundle.
+    for (int i = 0; i < BACKUP_DATA_FILE_COUNT; i++) // Walks every data file again.
+    {
+        if (!changedFiles[i]) continue; // Leaves untouched manifests alone.
+        char dataPath[BACKUP_PATH_LENGTH], manifestPath[BACKUP_PATH_LENGTH], name[BACKUP_PATH_LENGTH]; // Path buffers.
+        backupJoinPath(dataPath, sizeof(dataPath), dataDir, BACKUP_DATA_FILES[i]); // Builds the data file path.
+        snprintf(name, sizeof(name), "%s.manifest", BACKUP_DATA_FILES[i]); // Names the manifest.
+        backupGenerationPath(manifestPath, sizeof(manifestPath), backupDir, generation, name); // Builds the manifest path.
+        if (!backupWriteManifest(dataPath, manifestPath)) return -1; // Records the new state of the file.
+    }
+    return changedRecords; // Returns how many records the bundle holds.
+}
+
+// Writes a delta bundle holding only the records that changed in dataDir since the last backup.
+// Falls back to a full backup if none exists yet. Returns the number of changed records, or -1 on failure.
+static inline int performIncrementalBackup(const char *dataDir, const char *backupDir)
+{
+    if (!backupLockAcquire(backupDir, 1)) // Waits for any other process working on the backup.
+    {
+        printf("Error: Could not lock backup directory '%s'.\n", backupDir); // Prints an error message.
+        return -1; // Returns -1 (failure).
+    }
+    int result = backupIncrementalLocked(dataDir, backupDir); // Does the work while holding the lock.
+    backupLockRelease(); // Lets other processes back in.
+    return result; // Returns what the work returned.
+}
+
+// A private helper function to apply one delta bundle to the data files in targetDir.
+static inline int backupApplyBundle(const char *bundlePath, const char *targetDir)
+{
+    FILE *bundle = fopen(bundlePath, "r"); // Opens the bundle.
+    if (bundle == NULL) return 0; // Fails if the bundle is missing.
+
+    BackupRecordList records = {NULL, 0, 0}; // The records of the file currently being patched.
+    char targetPath[BACKUP_PATH_LENGTH] = ""; // The path of that file.
+    char line[BACKUP_LINE_LENGTH + 2]; // A buffer for each bundle line (with its marker).
+    char key[BACKUP_KEY_LENGTH]; // A buffer for record keys.
+    int ok = 1; // Tracks whether every step succeeded.
+
+    while (ok && fgets(line, sizeof(line), bundle)) // Reads the bundle line by line.
+    {
+        backupTrimLine(line); // Removes the newline.
+        if (line[0] == '@') // A section header names the next file to patch.
+        {
+            if (targetPath[0] != '\0') ok = backupListWrite(targetPath, &records); // Saves the previous file.
+            backupListFree(&records); // Clears the list for the next file.
+            backupJoinPath(targetPath, sizeof(targetPath), targetDir, line + 1); // Builds the next file's path.
+            ok = ok && backupListLoad(targetPath, &records); // Loads the next file.
+        }
+        else if ((line[0] == '+' || line[0] == '-') && targetPath[0] != '\0') // A record change.
+        {
+            backupRecordKey(line + 1, key, sizeof(key)); // Extracts the record key.
+            int index = backupListFind(&records, key); // Finds the existing record, if any.
+            if (line[0] == '-') // A deletion.
+            {
+                if (index < 0) continue; // Nothing to delete.
+                free(records.lines[index]); // Frees the deleted line.
+                memmove(&records.lines[index], &records.lines[index + 1], (records.count - index - 1) * sizeof(char *)); // Closes the gap, keeping order.
+                records.count--; // Shrinks the list.
+            }
+            else if (index >= 0) // An edit of an existing record.
+            {
+                char *copy = malloc(strlen(line + 1) + 1); // Allocates space for the new line.
+                if (copy == NULL) { ok = 0; break; } // Fails if memory ran out.
+                strcpy(copy, line + 1); // Copies the new line.
+                free(records.lines[index]); // Frees the old line.
+                records.lines[index] = copy; // Replaces it in place.
+            }
+            else // A new record.
+            {
+                ok = backupListAppend(&records, line + 1); // Appends it to the end, as the menus do.
+            }
+        }
+    }
+    if (ok && targetPath[0] != '\0') ok = backupListWrite(targetPath, &records); // Saves the last file.
+    backupListFree(&records); // Frees the records.
+    fclose(bundle); // Closes the bundle.
+    return ok; // Returns whether the bundle was fully applied.
+}
+
+// A private helper function that does the restore; the caller holds the backup lock.
+static inline int backupRestoreLocked(const char *backupDir, const char *targetDir)
+{
+    char statePath[BACKUP_PATH_LENGTH]; // A buffer for the state file path.
+    backupJoinPath(statePath, sizeof(statePath), backupDir, BACKUP_STATE_FILE); // Builds the state file path.
+    int generation, sequence; // The backup generation and last delta number.
+    if (!backupReadState(statePath, &generation, &sequence)) // Checks that a backup exists.
+    {
+        printf("Error: No backup found in '%s'.\n", backupDir); // Prints an error message.
+        return 0; // Returns 0 (failure).
+    }
+    if (!backupEnsureDirectory(targetDir)) // Makes sure the target directory exists.
+    {
+        printf("Error: Could not create directory '%s'.\n", targetDir); // Prints an error message.
+        return 0; // Returns 0 (failure).
+    }
+
+    char path[BACKUP_PATH_LENGTH], name[BACKUP_PATH_LENGTH], targetPath[BACKUP_PATH_LENGTH]; // Path buffers.
+    for (int i = 0; i < BACKUP_DATA_FILE_COUNT; i++) // Walks every data file.
+    {
+        snprintf(name, sizeof(name), "full_%s", BACKUP_DATA_FILES[i]); // Names the full copy.
+        backupGenerationPath(path, sizeof(path), backupDir, generation, name); // Builds the full copy path.
+        backupJoinPath(targetPath, sizeof(targetPath), targetDir, BACKUP_DATA_FILES[i]); // Builds the target path.
+        if (!backupCopyFile(path, targetPath)) return 0; // Restores the full copy.
+    }
+    for (int i = 1; i <= sequence; i++) // Walks the deltas in order.
+    {
+        backupBundlePath(path, sizeof(path), backupDir, generation, i); // Builds each bundle path.
+        if (!backupApplyBundle(path, targetDir)) // Applies the bundle.
+        {
+            printf("Error: Could not apply delta bundle '%s'.\n", path); // Prints an error message.
+            return 0; // Returns 0 (failure).
+        }
+    }
+
+    backupJoinPath(path, sizeof(path), targetDir, REPLICA_STATE_FILE); // Builds the replica state path.
+    return backupWriteState(path, generation, sequence); // Records what the directory now holds.
+}
+
+// Rebuilds every data file in targetDir from the last full backup plus all deltas in backupDir.
+// Returns 1 on success, 0 on failure.
+static inline int restoreFromBackup(const char *backupDir, const char *targetDir)
+{
+    if (!backupLockAcquire(backupDir, 1)) // Waits for any other process working on the backup.
+    {
+        printf("Error: Could not lock backup directory '%s'.\n", backupDir); // Prints an error message.
+        return 0; // Returns 0 (failure).
+    }
+    int result = backupRestoreLocked(backupDir, targetDir); // Does the work while holding the lock.
+    backupLockRelease(); // Lets other processes back in.
+    return result; // Returns what the work returned.
+}
+
+// A private helper function that does the replica sync; the caller holds the backup lock.
+static inline int backupSyncReplicaLocked(const char *dataDir, const char *backupDir, const char *replicaDir)
+{
+    if (performIncrementalBackup(dataDir, backupDir) < 0) return 0; // Captures the latest changes first.
+
+    char path[BACKUP_PATH_LENGTH]; // A buffer for assorted paths.
+    int generation, sequence, replicaGeneration, replicaSequence; // The backup and replica positions.
+    backupJoinPath(path, sizeof(path), backupDir, BACKUP_STATE_FILE); // Builds the backup state path.
+    if (!backupReadState(path, &generation, &sequence)) return 0; // Reads where the backup is.
+    backupJoinPath(path, sizeof(path), replicaDir, REPLICA_STATE_FILE); // Builds the replica state path.
+    if (!backupReadState(path, &replicaGeneration, &replicaSequence) || replicaGeneration != generation || replicaSequence > sequence) // Checks if the replica can catch up by deltas.
+    {
+        return restoreFromBackup(backupDir, replicaDir); // Rebuilds the replica from scratch.
+    }
+
+    for (int i = replicaSequence + 1; i <= sequence; i++) // Walks the deltas the replica has not seen.
+    {
+        char bundlePath[BACKUP_PATH_LENGTH]; // A buffer for the bundle path.
+        backupBundlePath(bundlePath, sizeof(bundlePath), backupDir, generation, i); // Builds each bundle path.
+        if (!backupApplyBundle(bundlePath, replicaDir)) return 0; // Applies the bundle to the replica.
+        if (!backupWriteState(path, generation, i)) return 0; // Records progress after each bundle.
+    }
+    return 1; // Returns 1 (success).
+}
+
+// Takes an incremental backup and ships only the new delta bundles to the warm replica in replicaDir.
+// A replica from an older generation (or a new one) is rebuilt with restoreFromBackup. Returns 1 on success.
+static inline int syncReplica(const char *dataDir, const char *backupDir, const char *replicaDir)
+{
+    if (!backupLockAcquire(backupDir, 1)) // Waits for any other process working on the backup.
+    {
+        printf("Error: Could not lock backup directory '%s'.\n", backupDir); // Prints an error message.
+        return 0; // Returns 0 (failure).
+    }
+    int result = backupSyncReplicaLocked(dataDir, backupDir, replicaDir); // Does the work while holding the lock.
+    backupLockRelease(); // Lets other processes back in.
+    return result; // Returns what the work returned.
+}
+
+// Keeps the default warm replica current; does nothing until a replica has been enabled from the backup menu.
+// Every operator process calls this after each action. If another process holds the backup lock, this one skips the
+// sync instead of waiting; the next sync picks up its changes.
+static inline void syncReplicaIfEnabled()
+{
+    char path[BACKUP_PATH_LENGTH]; // A buffer for the replica state path.
+    backupJoinPath(path, sizeof(path), REPLICA_DIR, REPLICA_STATE_FILE); // Builds the replica state path.
+    FILE *file = fopen(path, "r"); // Checks whether the replica has been enabled.
+    if (file == NULL) return; // Does nothing if there is no replica.
+    fclose(file); // Closes the state file.
+    if (!backupLockAcquire(BACKUP_DIR, 0)) return; // Leaves the sync to the process already running one.
+    if (!syncReplica(".", BACKUP_DIR, REPLICA_DIR)) // Ships the latest changes to the replica.
+    {
+        printf("Warning: Could not update the replica in '%s'.\n", REPLICA_DIR); // Warns the user without interrupting them.
+    }
+    backupLockRelease(); // Lets other processes back in.
+}
+
+#endif // Marks the end of the BACKUP_MANAGEMENT_H header guard.
@@ -0,0 +1,59 @@
+#ifndef BACKUP_MANAGEMENT_MENU_H // If BACKUP_MANAGEMENT_MENU_H is not defined,
+#define BACKUP_MANAGEMENT_MENU_H // Define BACKUP_MANAGEMENT_MENU_H to prevent multiple inclusions.
+
+#include <stdio.h> // Includes standard input/output functions.
+
+#include "BackupManagement.h" // Includes the backup, restore and replica functions.
+#include "SessionMetrics.h" // Includes the per-action timing used by the session harness.
+#include "ProductManagement.h" // Includes the validated input helpers used by the menu.
+
+// The menu for backup, restore and replica operations.
+static inline void backupManagementMenu()
+{
+    int choice; // The user's menu choice.
+    do // Starts the menu loop.
+    {
+        printf("\n\n--- Backup and Restore Menu ---\n"); // Prints the menu title.
+        printf("1. Full Backup\n"); // Menu option 1.
+        printf("2. Incremental Backup (changed records only)\n"); // Menu option 2.
+        printf("3. Restore Into Directory\n"); // Menu option 3.
+        printf("4. Enable / Sync Warm Replica ('%s')\n", REPLICA_DIR); // Menu option 4.
+        printf("0. Back to Main Menu\n"); // Menu option 0.
+        printf("---------------------------------\n"); // Prints a separator line.
+
+        choice = getValidIntegerInput("Enter your choice", 1, 0); // Gets a valid integer choice from the user.
+        SessionTimer actionTimer = sessionStartTimer(); // Starts timing the chosen action.
+
+        switch (choice) // Handles the user's choice.
+        {
+        case 1: // A full backup.
+            if (performFullBackup(".", BACKUP_DIR)) printf("Full backup written to '%s'.\n", BACKUP_DIR); // Reports success.
+            break; // Exits the switch.
+        case 2: // An incremental backup.
+        {
+            int changed = performIncrementalBackup(".", BACKUP_DIR); // Writes a delta bundle.
+            if (changed >= 0) printf("Incremental backup complete: %d changed record(s).\n", changed); // Reports the number of changes.
+            else printf("Error: Incremental backup failed.\n"); // Reports failure.
+            break; // Exits the switch.
+        }
+        case 3: // A restore.
+        {
+            char targetDir[BACKUP_PATH_LENGTH]; // A buffer for the target directory.
+            getValidString(targetDir, sizeof(targetDir), "Restore into directory (existing files there are overwritten)"); // Asks where to restore.
+            if (restoreFromBackup(BACKUP_DIR, targetDir)) printf("Data restored into '%s'.\n", targetDir); // Reports success.
+            break; // Exits the switch.
+        }
+        case 4: // Enables or refreshes the replica.
+            if (backupEnsureDirectory(REPLICA_DIR) && syncReplica(".", BACKUP_DIR, REPLICA_DIR)) // Creates and syncs the replica.
+                printf("Replica '%s' is up to date and will be kept in sync.\n", REPLICA_DIR); // Reports success.
+            else // If anything failed.
+                printf("Error: Could not update the replica in '%s'.\n", REPLICA_DIR); // Reports failure.
+            break; // Exits the switch.
+        case 0: printf("Returning to Main Menu...\n"); break; // Informs the user they are returning.
+        default: printf("Invalid choice. Please try again.\n"); break; // Handles invalid choices.
+        }
+        if (choice != 0) sessionRecordAction("backup", choice, actionTimer); // Logs how long the action took when timing is on.
+    } while (choice != 0); // The loop continues until the user chooses 0.
+}
+
+#endif // Marks the end of the BACKUP_MANAGEMENT_MENU_H header guard.
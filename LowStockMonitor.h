@@ -0,0 +1,402 @@
+#ifndef LOW_STOCK_MONITOR_H // If LOW_STOCK_MONITOR_H is not defined,
+#define LOW_STOCK_MONITOR_H // Define LOW_STOCK_MONITOR_H to prevent multiple inclusions.
+
+#include <stdio.h> // Includes standard input/output functions.
+#include <string.h> // Includes string handling functions.
+#include <stdlib.h> // Includes standard library functions like malloc and atoi.
+#include <sys/stat.h> // Includes stat() to notice inventory writes the monitor was not told about.
+#include <time.h> // Includes time() to tell when the file state was recorded.
+
+#include "FileHandling.h" // Includes MAX_ID_LENGTH and the other shared record limits.
+
+#define LOW_STOCK_INVENTORY_FILE "inventory.txt" // Defines the inventory file the monitor follows.
+#define REORDER_THRESHOLDS_FILE "reorder_thresholds.txt" // Defines the file holding "productID,threshold,supplierID" lines.
+#define LOW_STOCK_DEFAULT_THRESHOLD 5 // Defines the reorder threshold of products without one of their own.
+#define LOW_STOCK_NO_SUPPLIER "UNASSIGNED" // Defines the supplier shown for products without one.
+
+// The reorder state of one product.
+typedef struct
+{
+    char productID[MAX_ID_LENGTH]; // The product ID.
+    char supplierID[MAX_ID_LENGTH]; // The supplier the product is reordered from.
+    int quantity; // The current quantity in stock.
+    int threshold; // The quantity at or below which the product needs reordering.
+    int hasCustomThreshold; // Set when the threshold came from the thresholds file.
+    int heapIndex; // The product's position in the reorder heap, or -1 if it is not low.
+    int nextInBucket; // The next entry in the same hash bucket, or -1.
+    int inUse; // Cleared when the product is deleted.
+} LowStockEntry;
+
+// The monitor: every product, a hash index by product ID and a min-heap of the low ones.
+static struct
+{
+    LowStockEntry *entries; // Every product the monitor knows about.
+    int entryCount; // The number of entries used.
+    int entryCapacity; // The number of entries allocated.
+    int *buckets; // The hash index: the first entry of each bucket, or -1.
+    int bucketCount; // The number of buckets (always a power of two).
+    int *heap; // Entry indexes of low products, most urgent first.
+    int heapSize; // The number of low products.
+    int loaded; // Set once the monitor has been built.
+    long long inventorySize; // The inventory file size the monitor last accounted for.
+    long long inventoryMtime; // The inventory modification time the monitor last accounted for, in nanoseconds.
+    long long inventoryRecordedAt; // The clock time, in seconds, the file state above was recorded.
+    int inventorySelfWritten; // Set when the file state above came from a write made through the hooks.
+    int rebuildCount; // The number of full rebuilds so far, so tests can tell an incremental update from a rescan.
+} lowStockMonitor = {NULL, 0, 0, NULL, 0, NULL, 0, 0, -1, -1, -1, 0, 0};
+
+// A private helper function to order two entries: further below threshold first, then by product ID.
+static inline int lowStockMoreUrgent(int a, int b)
+{
+    const LowStockEntry *left = &lowStockMonitor.entries[a], *right = &lowStockMonitor.entries[b]; // The entries to compare.
+    int leftKey = left->quantity - left->threshold, rightKey = right->quantity - right->threshold; // How far each is from its threshold.
+    if (leftKey != rightKey) return leftKey < rightKey; // The more negative one is more urgent.
+    return strcmp(left->productID, right->productID) < 0; // Breaks ties by product ID so reports are stable.
+}
+
+// A private helper function to place an entry at a heap position and record the position in the entry.
+static inline void lowStockHeapPlace(int position, int entry)
+{
+    lowStockMonitor.heap[position] = entry; // Stores the entry in the heap.
+    lowStockMonitor.entries[entry].heapIndex = position; // Lets the entry find itself in O(1).
+}
+
+// A private helper function to move a heap entry up until its parent is more urgent.
+static inline void lowStockSiftUp(int position)
+{
+    int entry = lowStockMonitor.heap[position]; // The entry being moved.
+    while (position > 0) // Stops at the root.
+    {
+        int parent = (position - 1) / 2; // The parent position.
+        if (!lowStockMoreUrgent(entry, lowStockMonitor.heap[parent])) break; // Stops once the parent is more urgent.
+        lowStockHeapPlace(position, lowStockMonitor.heap[parent]); // Moves the parent down.
+        position = parent; // Continues from the parent's position.
+    }
+    lowStockHeapPlace(position, entry); // Puts the entry in its final position.
+}
+
+// A private helper function to move a heap entry down until its children are less urgent.
+static inline void lowStockSiftDown(int position)
+{
+    int entry = lowStockMonitor.heap[position]; // The entry being moved.
+    while (1) // Walks down the heap.
+    {
+        int child = position * 2 + 1; // The left child.
+        if (child >= lowStockMonitor.heapSize) break; // Stops at a leaf.
+        if (child + 1 < lowStockMonitor.heapSize && lowStockMoreUrgent(lowStockMonitor.heap[child + 1], lowStockMonitor.heap[child])) child++; // Picks the more urgent child.
+        if (!lowStockMoreUrgent(lowStockMonitor.heap[child], entry)) break; // Stops once the entry is more urgent than both.
+        lowStockHeapPlace(position, lowStockMonitor.heap[child]); // Moves the child up.
+        position = child; // Continues from the child's position.
+    }
+    lowStockHeapPlace(position, entry); // Puts the entry in its final position.
+}
+
+// A private helper function to add, move or remove an entry in the heap after its quantity or threshold changed.
+static inline void lowStockHeapUpdate(int entry)
+{
+    LowStockEntry *product = &lowStockMonitor.entries[entry]; // The entry that changed.
+    int isLow = product->inUse && product->quantity <= product->threshold; // Whether it needs reordering now.
+    if (isLow && product->heapIndex < 0) // Newly low: insert it.
+    {
+        lowStockHeapPlace(lowStockMonitor.heapSize, entry); // Places it at the end.
+        lowStockSiftUp(lowStockMonitor.heapSize++); // Moves it up to its place.
+    }
+    else if (!isLow && product->heapIndex >= 0) // No longer low: remove it.
+    {
+        int position = product->heapIndex; // Where it sits in the heap.
+        int last = lowStockMonitor.heap[--lowStockMonitor.heapSize]; // Takes the last heap entry.
+        product->heapIndex = -1; // Marks the entry as out of the heap.
+        if (last != entry) // Fills the hole unless the removed entry was the last one.
+        {
+            lowStockHeapPlace(position, last); // Moves the last entry into the hole.
+            lowStockSiftUp(position); // Moves it up if needed.
+            lowStockSiftDown(lowStockMonitor.entries[last].heapIndex); // Or down if needed.
+        }
+    }
+    else if (isLow) // Still low, but its urgency changed.
+    {
+        lowStockSiftUp(product->heapIndex); // Moves it up if it became more urgent.
+        lowStockSiftDown(product->heapIndex); // Or down if it became less urgent.
+    }
+}
+
+// A private helper function to hash a product ID to a bucket (FNV-1a).
+static inline int lowStockBucket(const char *productID)
+{
+    unsigned int hash = 2166136261u; // Starts from the FNV offset basis.
+    while (*productID) hash = (hash ^ (unsigned char)*productID++) * 16777619u; // Mixes in each character.
+    return (int)(hash & (unsigned int)(lowStockMonitor.bucketCount - 1)); // Masks to the bucket range.
+}
+
+// A private helper function to find a product's entry index, or -1.
+static inline int lowStockFind(const char *productID)
+{
+    if (lowStockMonitor.bucketCount == 0) return -1; // Nothing is indexed yet.
+    for (int i = lowStockMonitor.buckets[lowStockBucket(productID)]; i >= 0; i = lowStockMonitor.entries[i].nextInBucket) // Walks one bucket.
+    {
+        if (lowStockMonitor.entries[i].inUse && strcmp(lowStockMonitor.entries[i].productID, productID) == 0) return i; // Returns the match.
+    }
+    return -1; // Returns -1 if the product is unknown.
+}
+
+// A private helper function to add a product with the default threshold; returns its entry index, or -1.
+static inline int lowStockAdd(const char *productID)
+{
+    if (lowStockMonitor.entryCount == lowStockMonitor.entryCapacity) // Checks if the arrays are full.
+    {
+        int newCapacity = lowStockMonitor.entryCapacity ? lowStockMonitor.entryCapacity * 2 : 128; // Doubles the capacity.
+        LowStockEntry *entries = realloc(lowStockMonitor.entries, newCapacity * sizeof(LowStockEntry)); // Grows the entries.
+        if (entries == NULL) return -1; // Fails if memory ran out.
+        lowStockMonitor.entries = entries; // Stores the grown entries.
+        int *heap = realloc(lowStockMonitor.heap, newCapacity * sizeof(int)); // Grows the heap to match.
+        if (heap == NULL) return -1; // Fails if memory ran out.
+        lowStockMonitor.heap = heap; // Stores the grown heap.
+        int *buckets = malloc(newCapacity * sizeof(int)); // Keeps one bucket per entry slot.
+        if (buckets == NULL) return -1; // Fails if memory ran out.
+        free(lowStockMonitor.buckets); // Drops the old index.
+        lowStockMonitor.buckets = buckets; // Installs the new index.
+        lowStockMonitor.bucketCount = newCapacity; // Records its size.
+        lowStockMonitor.entryCapacity = newCapacity; // Records the new capacity.
+        for (int i = 0; i < newCapacity; i++) lowStockMonitor.buckets[i] = -1; // Empties every bucket.
+        for (int i = 0; i < lowStockMonitor.entryCount; i++) // Re-indexes the existing entries.
+        {
+            int bucket = lowStockBucket(lowStockMonitor.entries[i].productID); // Finds the new bucket.
+            lowStockMonitor.entries[i].nextInBucket = lowStockMonitor.buckets[bucket]; // Links it at the front.
+            lowStockMonitor.buckets[bucket] = i; // Stores it.
+        }
+    }
+
+    int index = lowStockMonitor.entryCount++; // Takes the next free entry.
+    LowStockEntry *product = &lowStockMonitor.entries[index]; // Points at it.
+    snprintf(product->productID, sizeof(product->productID), "%s", productID); // Copies the product ID.
+    strcpy(product->supplierID, LOW_STOCK_NO_SUPPLIER); // Starts without a supplier.
+    product->quantity = 0; // Starts with no stock until told otherwise.
+    product->threshold = LOW_STOCK_DEFAULT_THRESHOLD; // Starts with the default threshold.
+    product->hasCustomThreshold = 0; // Marks the threshold as the default.
+    product->heapIndex = -1; // Starts outside the heap.
+    product->inUse = 1; // Marks the entry as live.
+    int bucket = lowStockBucket(productID); // Finds its bucket.
+    product->nextInBucket = lowStockMonitor.buckets[bucket]; // Links it at the front.
+    lowStockMonitor.buckets[bucket] = index; // Stores it.
+    return index; // Returns the new entry index.
+}
+
+// A private helper function to read the inventory file's size and modification time (in nanoseconds where the system keeps them).
+static inline void lowStockInventoryStat(long long *size, long long *mtime)
+{
+    struct stat info; // Holds the file information.
+    if (stat(LOW_STOCK_INVENTORY_FILE, &info) == 0) // Checks if the file exists.
+    {
+        *size = (long long)info.st_size; // Returns its size.
+#if defined(_WIN32)
+        *mtime = (long long)info.st_mtime * 1000000000LL; // Windows stat() only keeps whole seconds.
+#elif defined(__APPLE__)
+        *mtime = (long long)info.st_mtimespec.tv_sec * 1000000000LL + info.st_mtimespec.tv_nsec; // Returns the full-resolution time.
+#else
+        *mtime = (long long)info.st_mtim.tv_sec * 1000000000LL + info.st_mtim.tv_nsec; // Returns the full-resolution time.
+#endif
+    }
+    else // If the file is missing.
+    {
+        *size = *mtime = -1; // Returns "no file".
+    }
+}
+
+// Releases everything the monitor holds; the next query rebuilds it.
+static inline void lowStockFree()
+{
+    free(lowStockMonitor.entries); // Frees the entries.
+    free(lowStockMonitor.buckets); // Frees the hash index.
+    free(lowStockMonitor.heap); // Frees the heap.
+    lowStockMonitor.entries = NULL; // Clears the pointers.
+    lowStockMonitor.buckets = lowStockMonitor.heap = NULL; // Continues clearing.
+    lowStockMonitor.entryCount = lowStockMonitor.entryCapacity = 0; // Resets the counters.
+    lowStockMonitor.bucketCount = lowStockMonitor.heapSize = 0; // Continues resetting.
+    lowStockMonitor.loaded = 0; // Marks the monitor as not built.
+}
+
+// A private helper function to build the monitor with one pass over the inventory and thresholds files.
+static inline void lowStockRebuild()
+{
+    lowStockFree(); // Starts from an empty monitor.
+    lowStockMonitor.loaded = 1; // Marks the monitor as built, even if the files are empty.
+    lowStockMonitor.rebuildCount++; // Counts the full rescan.
+    lowStockMonitor.inventoryRecordedAt = (long long)time(NULL); // Notes the time before reading, so a write later in this second is not trusted.
+    lowStockMonitor.inventorySelfWritten = 0; // This state was read, not written by the monitor's callers.
+    lowStockInventoryStat(&lowStockMonitor.inventorySize, &lowStockMonitor.inventoryMtime); // Remembers the file state being read.
+
+    FILE *file = fopen(LOW_STOCK_INVENTORY_FILE, "r"); // Opens the inventory file.
+    if (file != NULL) // Reads products only if the file exists.
+    {
+        char productID[MAX_ID_LENGTH], categoryID[MAX_ID_LENGTH], name[MAX_NAME_LENGTH], description[MAX_DESCRIPTION_LENGTH]; // Field buffers.
+        char tempPriceStr[50], tempQuantityStr[50]; // Temporary strings for price and quantity.
+        while (fscanf(file, "%10[^,],%10[^,],%50[^,],%49[^,],%49[^,],%200[^\n]\n",
+                      productID, categoryID, name, tempPriceStr, tempQuantityStr, description) == 6) // Reads each product.
+        {
+            int index = lowStockFind(productID); // Looks for a duplicate line.
+            if (index < 0) index = lowStockAdd(productID); // Adds the product.
+            if (index >= 0) lowStockMonitor.entries[index].quantity = atoi(tempQuantityStr); // Records its quantity.
+        }
+        fclose(file); // Closes the inventory file.
+    }
+
+    file = fopen(REORDER_THRESHOLDS_FILE, "r"); // Opens the thresholds file.
+    if (file != NULL) // Reads thresholds only if the file exists.
+    {
+        char productID[MAX_ID_LENGTH], supplierID[MAX_ID_LENGTH]; // Field buffers.
+        int threshold; // The product's threshold.
+        while (fscanf(file, "%10[^,],%d,%10[^\n]\n", productID, &threshold, supplierID) == 3) // Reads each threshold.
+        {
+            int index = lowStockFind(productID); // Finds the product.
+            if (index < 0) continue; // Ignores thresholds for products that no longer exist.
+            lowStockMonitor.entries[index].threshold = threshold; // Applies the threshold.
+            lowStockMonitor.entries[index].hasCustomThreshold = 1; // Marks it as set by the user.
+            strcpy(lowStockMonitor.entries[index].supplierID, supplierID); // Applies the supplier.
+        }
+        fclose(file); // Closes the thresholds file.
+    }
+
+    for (int i = 0; i < lowStockMonitor.entryCount; i++) lowStockHeapUpdate(i); // Puts every low product in the heap.
+}
+
+// A private helper function to check that the monitor is built and the inventory file has not changed since it was recorded.
+// After a hooked write, the same size and modification time are enough. A state the monitor only read is not trusted
+// if the file was modified in the same second, because an unhooked write on a coarse clock could keep the same mtime.
+static inline int lowStockInventoryUnchanged()
+{
+    if (!lowStockMonitor.loaded) return 0; // Nothing has been recorded yet.
+    long long size, mtime; // The current inventory file state.
+    lowStockInventoryStat(&size, &mtime); // Reads it.
+    if (size != lowStockMonitor.inventorySize || mtime != lowStockMonitor.inventoryMtime) return 0; // The file changed.
+    return lowStockMonitor.inventorySelfWritten || mtime / 1000000000LL < lowStockMonitor.inventoryRecordedAt; // Applies the same-second rule to reads only.
+}
+
+// A private helper function to make sure the monitor exists and reflects the inventory file.
+// Writes made through the hooks below are accounted for; any other write to the file triggers one rebuild.
+static inline void lowStockEnsureCurrent()
+{
+    if (!lowStockInventoryUnchanged()) lowStockRebuild(); // Rebuilds from the files after untracked changes.
+}
+
+// A private helper function to record that the inventory file now matches the monitor.
+static inline void lowStockMarkInventorySeen()
+{
+    lowStockMonitor.inventoryRecordedAt = (long long)time(NULL); // Notes when the state was recorded.
+    lowStockMonitor.inventorySelfWritten = 1; // The caller made this write and told the monitor what it changed.
+    lowStockInventoryStat(&lowStockMonitor.inventorySize, &lowStockMonitor.inventoryMtime); // Remembers the file state.
+}
+
+// Call before writing inventory.txt through a hooked path. If something else changed the file since the monitor
+// last looked, the monitor is dropped so the hook after the write cannot mark that change as accounted for.
+static inline void lowStockBeforeInventoryWrite()
+{
+    if (lowStockMonitor.loaded && !lowStockInventoryUnchanged()) lowStockMonitor.loaded = 0; // The next query rebuilds.
+}
+
+// Tells the monitor a product's quantity changed (product update, stock movement or transaction) after inventory.txt was written.
+// The writer must call lowStockBeforeInventoryWrite() before the write.
+static inline void lowStockOnQuantityChanged(const char *productID, int newQuantity)
+{
+    if (!lowStockMonitor.loaded) return; // Nothing to update; the first query will read the file.
+    int index = lowStockFind(productID); // Finds the product.
+    if (index < 0) index = lowStockAdd(productID); // Adds it if it is new.
+    if (index < 0) // Checks if memory ran out.
+    {
+        lowStockMonitor.loaded = 0; // Falls back to a rebuild on the next query.
+        return; // Exits the function.
+    }
+    lowStockMonitor.entries[index].quantity = newQuantity; // Records the new quantity.
+    lowStockHeapUpdate(index); // Moves it into, around or out of the heap.
+    lowStockMarkInventorySeen(); // Records that this write is accounted for.
+}
+
+// Tells the monitor a product was deleted from inventory.txt. The writer must call lowStockBeforeInventoryWrite() before the write.
+static inline void lowStockOnProductRemoved(const char *productID)
+{
+    if (!lowStockMonitor.loaded) return; // Nothing to update; the first query will read the file.
+    int index = lowStockFind(productID); // Finds the product.
+    if (index >= 0) // Checks if it was known.
+    {
+        lowStockMonitor.entries[index].inUse = 0; // Marks the entry as deleted.
+        lowStockHeapUpdate(index); // Removes it from the heap.
+    }
+    lowStockMarkInventorySeen(); // Records that this write is accounted for.
+}
+
+// A private helper function to save every custom threshold, writing a temporary file and renaming it over the old one.
+static inline int lowStockSaveThresholds()
+{
+    char tempPath[] = REORDER_THRESHOLDS_FILE ".tmp"; // The temporary file the thresholds are written to first.
+    FILE *file = fopen(tempPath, "w"); // Opens the temporary file.
+    if (file == NULL) return 0; // Fails if it cannot be written.
+    for (int i = 0; i < lowStockMonitor.entryCount; i++) // Walks every product.
+    {
+        const LowStockEntry *entry = &lowStockMonitor.entries[i]; // Points at the entry.
+        if (entry->inUse && entry->hasCustomThreshold) fprintf(file, "%s,%d,%s\n", entry->productID, entry->threshold, entry->supplierID); // Saves custom thresholds only.
+    }
+    int failed = ferror(file); // Checks for write errors.
+    if (fclose(file) != 0) failed = 1; // Checks that the data reached the file.
+#ifdef _WIN32
+    if (!failed) remove(REORDER_THRESHOLDS_FILE); // Windows rename will not overwrite an existing file.
+#endif
+    if (failed || rename(tempPath, REORDER_THRESHOLDS_FILE) != 0) // Replaces the old file (in one step on POSIX).
+    {
+        remove(tempPath); // Cleans up the temporary file.
+        return 0; // Fails, leaving the old file untouched.
+    }
+    return 1; // Returns 1 (success).
+}
+
+// Sets a product's reorder threshold and supplier and saves every custom threshold. Returns 1 on success.
+// If the file cannot be saved, the monitor keeps the old threshold so memory and disk stay in step.
+static inline int lowStockSetThreshold(const char *productID, int threshold, const char *supplierID)
+{
+    lowStockEnsureCurrent(); // Makes sure the monitor is built.
+    int index = lowStockFind(productID); // Finds the product.
+    if (index < 0) return 0; // Fails for unknown products.
+    LowStockEntry *product = &lowStockMonitor.entries[index]; // Points at the entry.
+    LowStockEntry previous = *product; // Keeps the old values in case the save fails.
+    product->threshold = threshold; // Records the threshold.
+    product->hasCustomThreshold = 1; // Marks it as set by the user.
+    snprintf(product->supplierID, sizeof(product->supplierID), "%s", supplierID); // Records the supplier.
+
+    if (!lowStockSaveThresholds()) // Saves the thresholds before touching the heap.
+    {
+        *product = previous; // Restores the old values; the heap was not changed yet.
+        return 0; // Returns 0 (failure).
+    }
+    lowStockHeapUpdate(index); // Moves it into, around or out of the heap.
+    return 1; // Returns 1 (success).
+}
+
+// Returns the products that need reordering now, most urgent first, in a new array the caller frees.
+// Costs O(k log k) for k low products; the rest of the inventory is not read.
+static inline LowStockEntry *lowStockReorderList(int *countOut)
+{
+    lowStockEnsureCurrent(); // Makes sure the monitor reflects the inventory.
+    *countOut = 0; // Starts with an empty list.
+    if (lowStockMonitor.heapSize == 0) return NULL; // Nothing needs reordering.
+
+    LowStockEntry *list = malloc(lowStockMonitor.heapSize * sizeof(LowStockEntry)); // The ordered result.
+    int *saved = malloc(lowStockMonitor.heapSize * sizeof(int)); // A copy of the heap to restore afterwards.
+    if (list == NULL || saved == NULL) // Checks if memory ran out.
+    {
+        free(list); // Frees whatever was allocated.
+        free(saved); // Continues freeing.
+        return NULL; // Returns an empty list.
+    }
+    int heapSize = lowStockMonitor.heapSize; // Remembers the heap size.
+    memcpy(saved, lowStockMonitor.heap, heapSize * sizeof(int)); // Saves the heap.
+    while (lowStockMonitor.heapSize > 0) // Pops every entry in order.
+    {
+        list[(*countOut)++] = lowStockMonitor.entries[lowStockMonitor.heap[0]]; // Copies the most urgent entry.
+        lowStockHeapPlace(0, lowStockMonitor.heap[--lowStockMonitor.heapSize]); // Moves the last entry to the root.
+        if (lowStockMonitor.heapSize > 0) lowStockSiftDown(0); // Restores the heap order.
+    }
+    lowStockMonitor.heapSize = heapSize; // Restores the heap size.
+    for (int i = 0; i < heapSize; i++) lowStockHeapPlace(i, saved[i]); // Restores the heap and each entry's position.
+    free(saved); // Frees the copy.
+    return list; // Returns the ordered list.
+}
+
+#endif // Marks the end of the LOW_STOCK_MONITOR_H header guard.
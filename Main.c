@@ -9,6 +9,9 @@
 #include "InventoryStockManagement.h"    // Includes your functions for managing inventory.
 #include "CategorySupplierManagement.h"  // Includes your functions for categories and suppliers.
 #include "CustomerTransactionManagement.h" // Includes your functions for customers and transactions.
+#include "BackupManagementMenu.h"          // Includes your functions for backups and the warm replica.
+#include "SessionMetrics.h"                // Includes the per-action timing used by the session harness.
+#include "AdminCredentialStore.h"          // Includes the hashed, indexed admin credential store.
 
 #define ADMIN_FILE "admins.txt" // Defines a constant for the admin data filename.
 
@@ -18,9 +21,33 @@ int verifyAdminCredentials(const char *adminID, const char *password); // Declar
 void getStringInput(const char *prompt, char *buffer, int buffer_size); // Declares a helper function to get string input safely.
 int getIntegerInput(const char *prompt); // Declares a helper function to get integer input safely.
 
-int main() // The main function where the program starts execution.
+int main(int argc, char *argv[]) // The main function where the program starts execution.
 {
     checkFileExist(ADMIN_FILE); // Ensures the admin file exists before starting.
+    if (argc == 2 && strcmp(argv[1], "--migrate-admins") == 0) // Checks if the admin password migration was requested.
+    {
+        int migrated = migrateAdminFile(ADMIN_FILE); // Replaces every plaintext password with a salted hash.
+        if (migrated < 0) return 1; // Returns 1 to indicate the migration failed.
+        printf("Migrated %d admin password(s) in '%s' to salted hashes.\n", migrated, ADMIN_FILE); // Reports the result.
+        printf("Take a new full backup so older backups of '%s' can be discarded.\n", ADMIN_FILE); // Older copies still hold plaintext.
+        return 0; // Returns 0 to indicate success.
+    }
+    if (argc == 2 && strcmp(argv[1], "--full-backup") == 0) // Checks if a scheduled full backup was requested.
+    {
+        return performFullBackup(".", BACKUP_DIR) ? 0 : 1; // Returns 0 only if the backup was written.
+    }
+    if (argc == 2 && strcmp(argv[1], "--incremental-backup") == 0) // Checks if a scheduled incremental backup was requested.
+    {
+        int changed = performIncrementalBackup(".", BACKUP_DIR); // Writes a delta bundle of the changed records.
+        if (changed < 0) return 1; // Returns 1 to indicate the backup failed.
+        printf("Incremental backup complete: %d changed record(s).\n", changed); // Reports the number of changes.
+        syncReplicaIfEnabled(); // Ships the new bundle to the warm replica, if one is enabled.
+        return 0; // Returns 0 to indicate success.
+    }
+    if (argc == 3 && strcmp(argv[1], "--restore") == 0) // Checks if a restore into a directory was requested.
+    {
+        return restoreFromBackup(BACKUP_DIR, argv[2]) ? 0 : 1; // Returns 0 only if every file was rebuilt.
+    }
     checkFileExist("inventory.txt"); // Ensures the inventory file exists.
     checkFileExist("categories.txt"); // Ensures the categories file exists.
     checkFileExist("suppliers.txt"); // Ensures the suppliers file exists.
@@ -52,6 +79,8 @@ int main() // The main function where the program starts execution.
     } while (keepRunningApp); // The loop continues until keepRunningApp becomes 0.
 
     freeAllLists(); // Calls a function to free any allocated memory before exiting.
+    adminStoreFree(); // Frees the cached admin index.
+    lowStockFree(); // Frees the low-stock monitor.
     printf("\nSystem shutting down. Thank you!\n"); // Prints a shutdown message.
     return 0; // Returns 0 to indicate the program finished successfully.
 }
@@ -66,10 +95,12 @@ void mainSystemMenu(int *loggedInStatus, int *keepRunningApp, const char *curren
         printf("2. Inventory and Stock Management\n"); // Prints menu option 2.
         printf("3. Category and Supplier Management\n"); // Prints menu option 3.
         printf("4. User and Transaction Management\n"); // Prints menu option 4.
+        printf("5. Backup and Restore\n"); // Prints menu option 5.
         printf("0. Logout\n"); // Prints menu option 0 for logging out.
         printf("--------------------------\n"); // Prints a separator line.
 
         choice = getIntegerInput("Enter your choice: "); // Prompts for and gets the user's choice.
+        SessionTimer sessionTimer = sessionStartTimer(); // Starts timing the submenu session.
 
         switch (choice) // Starts a switch statement to handle the user's choice.
         {
@@ -85,19 +116,25 @@ void mainSystemMenu(int *loggedInStatus, int *keepRunningApp, const char *curren
         case 4: // If the user chose 4.
             user_transaction_main(currentAdminID); // Calls the user and transaction management function.
             break; // Exits the switch statement.
+        case 5: // If the user chose 5.
+            backupManagementMenu(); // Calls the backup and restore menu function.
+            break; // Exits the switch statement.
         case 0: // If the user chose 0.
             printf("\nLogging out user %s...\n", currentAdminID); // Prints a logout message with the admin's ID.
             *loggedInStatus = 0; // Sets the logged-in status to 0 (false).
             break; // Exits the switch statement.
         default: // If the user entered an invalid choice.
-            printf("Invalid choice. Please enter a number between 0 and 4.\n"); // Prints an error message.
+            printf("Invalid choice. Please enter a number between 0 and 5.\n"); // Prints an error message.
         }
 
+        if (choice >= 1 && choice <= 5) sessionRecordSession("main", choice, sessionTimer); // Logs the submenu session when timing is on.
+        syncReplicaIfEnabled(); // Ships any records changed by this action to the warm replica, if one is enabled.
+
         if (choice != 0) // Checks if the user's choice was not to log out.
         {
             printf("\nPress Enter to return to the Main Menu..."); // Prompts the user to press Enter.
             int c; // Declares a character variable to clear the input buffer.
-            while ((c = getchar()) != '\n' && c != EOF); // Waits for the Enter key to be pressed.
+            while ((c = sessionReadChar()) != '\n' && c != EOF); // Waits for the Enter key, leaving the wait out of timings.
         }
 
     } while (choice != 0); // The loop continues until the user chooses 0 to log out.
@@ -135,36 +172,13 @@ int handleLogin(char *loggedInAdminID) // Function to manage the user login proc
 
 int verifyAdminCredentials(const char *adminID, const char *password) // Function to check credentials against the admin file.
 {
-    FILE *file = fopen(ADMIN_FILE, "r"); // Opens the admin file in "read" mode.
-    if (file == NULL) // Checks if the file failed to open.
-    {
-        printf("Critical Error: Cannot open admin file for verification.\n"); // Prints a critical error message.
-        return 0; // Returns 0 to indicate failure.
-    }
-
-    Admin admin; // Declares a variable of type Admin struct to hold data from the file.
-    char line[512]; // Creates a character array to read each line from the file.
-
-    while (fgets(line, sizeof(line), file)) // Reads the file line by line until the end.
-    {
-        // Parses the line to extract the admin ID and password, skipping other fields.
-        if (sscanf(line, "%[^,],%*[^,],%*[^,],%*[^,],%*[^,],%s", admin.adminID, admin.password) == 2)
-        {
-            if (strcmp(admin.adminID, adminID) == 0 && strcmp(admin.password, password) == 0) // Compares the file's credentials with the user's input.
-            {
-                fclose(file); // Closes the file.
-                return 1; // Returns 1 to indicate the credentials match.
-            }
-        }
-    }
-    fclose(file); // Closes the file if no match was found.
-    return 0; // Returns 0 to indicate no matching credentials were found.
+    return adminStoreVerify(ADMIN_FILE, adminID, password); // Looks the admin up in the cached hash index and checks the salted hash.
 }
 
 void getStringInput(const char *prompt, char *buffer, int buffer_size) // A safe function to get a line of text from the user.
 {
     printf("%s", prompt); // Prints the prompt message to the screen.
-    if (fgets(buffer, buffer_size, stdin) != NULL) // Reads a line of input from the keyboard, including the newline.
+    if (sessionReadLine(buffer, buffer_size) != NULL) // Reads a line of input from the keyboard, including the newline.
     {
         buffer[strcspn(buffer, "\n")] = 0; // Finds the newline character and replaces it with a null terminator.
     }
@@ -181,7 +195,7 @@ int getIntegerInput(const char *prompt) // A safe function to get an integer fro
     char term; // Declares a character to check for extra characters after the number.
 
     printf("%s", prompt); // Prints the prompt message to the screen.
-    if (fgets(buffer, sizeof(buffer), stdin) != NULL) // Reads the entire line of input from the user.
+    if (sessionReadLine(buffer, sizeof(buffer)) != NULL) // Reads the entire line of input from the user.
     {
         // Tries to convert the input to an integer and checks if there are any trailing characters.
         if (sscanf(buffer, "%d%c", &value, &term) == 2 && term == '\n')
@@ -189,5 +203,9 @@ int getIntegerInput(const char *prompt) // A safe function to get an integer fro
             return value; // Returns the valid integer value.
         }
     }
+    else if (feof(stdin)) // Checks if the input stream has ended (e.g. a replayed script ran out).
+    {
+        return 0; // Returns 0 so the menus log out instead of looping forever.
+    }
     return -1; // Returns -1 to indicate the input was not a valid integer.
 }
\ No newline at end of file
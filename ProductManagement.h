@@ -8,9 +8,12 @@
 
 #include "FileHandling.h" // Includes your custom file handling definitions.
 #include "FormatHandling.h" // Includes your custom format handling definitions.
+#include "SessionMetrics.h" // Includes the per-action timing used by the session harness.
+#include "LowStockMonitor.h" // Includes the incremental low-stock monitor and its reorder heap.
 
 #define INVENTORY_FILE "inventory.txt" // Defines a constant for the inventory filename.
 #define CATEGORIES_FILE "categories.txt" // Defines a constant for the categories filename.
+#define SUPPLIERS_FILE "suppliers.txt" // Defines a constant for the suppliers filename.
 
 // A private helper function to get a non-empty string from the user with validation.
 static inline void getValidString(char *outputBuffer, int bufferSize, const char *prompt)
@@ -19,8 +22,13 @@ static inline void getValidString(char *outputBuffer, int bufferSize, const char
     do // Starts a loop that continues until valid input is received.
     {
         printf("%s: ", prompt); // Prints the prompt message to the user.
-        if (fgets(tempBuffer, sizeof(tempBuffer), stdin) == NULL) // Reads a line of input safely.
+        if (sessionReadLine(tempBuffer, sizeof(tempBuffer)) == NULL) // Reads a line of input safely.
         {
+            if (feof(stdin)) // Checks if the input stream has ended (e.g. a replayed script ran out).
+            {
+                printf("\nInput closed before a value was entered. Exiting.\n"); // Explains the early exit.
+                exit(EXIT_FAILURE); // Exits instead of re-prompting forever.
+            }
             printf("Error reading input. Please try again.\n"); // Handles potential input errors.
             tempBuffer[0] = '\0'; // Resets the buffer to be empty.
             continue; // Skips the rest of the loop and tries again.
@@ -212,6 +220,58 @@ static inline int displayAndSelectCategory(char *selectedCategoryID)
     } while (1); // The loop continues until a valid choice is made or the user cancels.
 }
 
+// A private helper function to display all available suppliers and let the user select one.
+// Only the first two fields of each line (supplier ID and name) are read, so the rest of the record may change freely.
+static inline int displayAndSelectSupplier(char *selectedSupplierID)
+{
+    FILE *file = fopen(SUPPLIERS_FILE, "r"); // Opens the suppliers file in read mode.
+    if (file == NULL) // Checks if the file failed to open.
+    {
+        printf("Error: Could not open suppliers file '%s'.\n", SUPPLIERS_FILE); // Prints an error message.
+        return 0; // Returns 0 (failure).
+    }
+
+    char supplierIDs[MAX_RECORDS][MAX_ID_LENGTH]; // Holds the ID of every supplier found.
+    char supplierName[MAX_NAME_LENGTH]; // Holds the name of the supplier being printed.
+    char line[MAX_DESCRIPTION_LENGTH + 2 * MAX_NAME_LENGTH]; // Holds one line of the file.
+    int supplierCount = 0; // Initializes a counter for the number of suppliers found.
+
+    printf("\n--- Available Suppliers ---\n"); // Prints a title for the list.
+    while (supplierCount < MAX_RECORDS && fgets(line, sizeof(line), file) != NULL) // Reads the file one line at a time.
+    {
+        if (sscanf(line, "%10[^,],%50[^,\n]", supplierIDs[supplierCount], supplierName) != 2) continue; // Skips lines without an ID and a name.
+        printf("%d. %s - %s\n", supplierCount + 1, supplierIDs[supplierCount], supplierName); // Prints each supplier as a numbered option.
+        supplierCount++; // Increments the supplier counter.
+    }
+    fclose(file); // Closes the suppliers file.
+
+    if (supplierCount == 0) // Checks if no suppliers were found.
+    {
+        printf("No suppliers available. Please add suppliers first.\n"); // Informs the user that no suppliers exist.
+        return 0; // Returns 0 (failure).
+    }
+
+    int choice; // Declares a variable for the user's numeric choice.
+    do // Starts a loop to get a valid selection from the user.
+    {
+        choice = getValidIntegerInput("Select Supplier (by number, 0 to Cancel)", 1, 0); // Asks the user for their choice.
+        if (choice == 0) // Checks if the user wants to cancel the operation.
+        {
+            printf("Supplier selection cancelled.\n"); // Confirms cancellation.
+            return 0; // Returns 0 to indicate cancellation.
+        }
+        if (choice >= 1 && choice <= supplierCount) // Checks if the choice is a valid number in the list.
+        {
+            strcpy(selectedSupplierID, supplierIDs[choice - 1]); // Copies the chosen supplier's ID to the output variable.
+            return 1; // Returns 1 (success).
+        }
+        else // If the choice is out of the valid range.
+        {
+            printf("Invalid selection. Please enter a number between 1 and %d, or 0 to cancel.\n", supplierCount); // Prints an error message.
+        }
+    } while (1); // The loop continues until a valid choice is made or the user cancels.
+}
+
 // A private helper function to display all available products and let the user select one.
 static inline int displayAndSelectProductID(char *selectedProductID)
 {
@@ -273,6 +333,7 @@ static inline int displayAndSelectProductID(char *selectedProductID)
 static inline void addNewProduct_local(const Inventory *newProduct)
 {
     checkFileExist(INVENTORY_FILE); // Ensures the inventory file exists before trying to write to it.
+    lowStockBeforeInventoryWrite(); // Lets the low-stock monitor notice earlier writes it was not told about.
     FILE *file = fopen(INVENTORY_FILE, "a"); // Opens the inventory file in "append" mode to add to the end.
     if (file == NULL) // Checks if the file failed to open.
     {
@@ -290,6 +351,7 @@ static inline void addNewProduct_local(const Inventory *newProduct)
             newProduct->description);
 
     fclose(file); // Closes the file to save the changes.
+    lowStockOnQuantityChanged(newProduct->productID, newProduct->quantity); // Tells the low-stock monitor about the new product.
     printf("Inventory data added successfully.\n"); // Prints a success confirmation message.
 }
 
@@ -392,7 +454,9 @@ static inline void updateProductInfo()
 
         if (attributeToUpdate) // Checks if an attribute was successfully chosen for an update.
         {
+            lowStockBeforeInventoryWrite(); // Lets the low-stock monitor notice earlier writes it was not told about.
             updateDataInventory(INVENTORY_FILE, attributeToUpdate, productIDToUpdate, newValueBuffer); // Calls the generic update function to modify the file.
+            if (fieldChoice == 4) lowStockOnQuantityChanged(productIDToUpdate, atoi(newValueBuffer)); // Keeps the reorder heap in step with the new quantity.
             printf("\n--- Field Updated Successfully ---\n"); // Prints a success message.
         }
 
@@ -431,7 +495,9 @@ static inline void deleteProduct()
 
     if (strcmp(confirmation, "yes") == 0) // Checks if the user confirmed with "yes".
     {
+        lowStockBeforeInventoryWrite(); // Lets the low-stock monitor notice earlier writes it was not told about.
         deleteDataInventory(INVENTORY_FILE, productIDToDelete); // Calls the function to delete the product's record from the file.
+        lowStockOnProductRemoved(productIDToDelete); // Drops the product from the low-stock monitor.
     }
     else // If the user did not type "yes".
     {
@@ -495,11 +561,67 @@ static inline void viewAllProducts_local()
         printf("\nTotal products displayed: %d\n", count); // Prints the total number of products shown.
 }
 
+// A function to show the products that need reordering now, grouped by supplier.
+static inline void viewReorderReport()
+{
+    printf("\n--- Products Needing Reorder ---\n"); // Prints the title for the screen.
+    int count; // The number of products that need reordering.
+    LowStockEntry *list = lowStockReorderList(&count); // Gets them, most urgent first, without rescanning the inventory.
+    if (count == 0) // Checks if nothing needs reordering.
+    {
+        printf("All products are above their reorder thresholds.\n"); // Informs the user.
+        free(list); // Frees the (empty) list.
+        return; // Exits the function.
+    }
+
+    for (int i = 0; i < count; i++) // Walks the list; each supplier is printed at its most urgent product.
+    {
+        int seenBefore = 0; // Tracks whether this supplier has already been printed.
+        for (int j = 0; j < i && !seenBefore; j++) seenBefore = strcmp(list[j].supplierID, list[i].supplierID) == 0; // Looks for an earlier product of the same supplier.
+        if (seenBefore) continue; // Skips suppliers that were already printed.
+
+        printf("\nSupplier: %s\n", list[i].supplierID); // Prints the supplier heading.
+        for (int j = i; j < count; j++) // Prints this supplier's products in order of urgency.
+        {
+            if (strcmp(list[j].supplierID, list[i].supplierID) != 0) continue; // Skips other suppliers.
+            printf("  %-10s quantity %4d  threshold %4d  short by %d\n", list[j].productID, list[j].quantity,
+                   list[j].threshold, list[j].threshold - list[j].quantity); // Prints the product's shortfall.
+        }
+    }
+    printf("\nTotal products needing reorder: %d\n", count); // Prints the total.
+    free(list); // Frees the list.
+}
+
+// A function to set the reorder threshold and supplier of a product.
+static inline void setReorderThreshold()
+{
+    printf("\n--- Set Reorder Threshold ---\n"); // Prints the title for the screen.
+    char productID[MAX_ID_LENGTH]; // A buffer to hold the ID of the product.
+    if (!displayAndSelectProductID(productID)) // Asks the user to select a product.
+    {
+        printf("Threshold update aborted.\n"); // Informs the user that the process was cancelled.
+        return; // Exits if no product was selected.
+    }
+
+    int threshold = getValidIntegerInput("Enter reorder threshold", 1, 0); // Gets the quantity at or below which to reorder.
+    char supplierID[MAX_ID_LENGTH]; // A buffer for the supplier ID.
+    if (!displayAndSelectSupplier(supplierID)) // Asks the user to pick the supplier to reorder from.
+    {
+        printf("Threshold update aborted.\n"); // Informs the user that the process was cancelled.
+        return; // Exits if no supplier was selected.
+    }
+    if (lowStockSetThreshold(productID, threshold, supplierID)) // Saves the threshold and updates the heap.
+        printf("Reorder threshold for %s set to %d (supplier %s).\n", productID, threshold, supplierID); // Confirms the change.
+    else // If the threshold could not be saved.
+        printf("Error: Could not save the reorder threshold for %s.\n", productID); // Prints an error message.
+}
+
 // The main menu for all product-related operations.
 static inline void productManagementMenu()
 {
     checkFileExist(INVENTORY_FILE); // Ensures the inventory file exists.
     checkFileExist(CATEGORIES_FILE); // Ensures the categories file exists.
+    checkFileExist(SUPPLIERS_FILE); // Ensures the suppliers file exists.
 
     int choice; // A variable to hold the user's menu choice.
     do // Starts the menu loop.
@@ -510,10 +632,13 @@ static inline void productManagementMenu()
         printf("3. Delete Product\n"); // Menu option 3.
         printf("4. View Specific Product Details\n"); // Menu option 4.
         printf("5. View All Products\n"); // Menu option 5.
+        printf("6. View Products Needing Reorder\n"); // Menu option 6.
+        printf("7. Set Reorder Threshold\n"); // Menu option 7.
         printf("0. Back to Main Menu\n"); // Menu option 0.
         printf("---------------------------------\n"); // Prints a separator line.
 
         choice = getValidIntegerInput("Enter your choice", 1, 0); // Gets a valid integer choice from the user.
+        SessionTimer actionTimer = sessionStartTimer(); // Starts timing the chosen action.
 
         switch (choice) // Handles the user's choice.
         {
@@ -522,14 +647,17 @@ static inline void productManagementMenu()
         case 3: deleteProduct(); break; // Calls the delete product function.
         case 4: viewSpecificProductDetails(); break; // Calls the view specific product function.
         case 5: viewAllProducts_local(); break; // Calls the view all products function.
+        case 6: viewReorderReport(); break; // Calls the reorder report function.
+        case 7: setReorderThreshold(); break; // Calls the set threshold function.
         case 0: printf("Returning to Main Menu...\n"); break; // Informs the user they are returning.
         default: printf("Invalid choice. Please try again.\n"); break; // Handles invalid numeric choices.
         }
+        if (choice != 0) sessionRecordAction("product", choice, actionTimer); // Logs how long the action took when timing is on.
 
         if (choice != 0) // If the user is not exiting the menu.
         {
             printf("\nPress Enter to continue..."); // Prompts the user to press Enter.
-            getchar(); // Waits for a single character input to pause the screen.
+            sessionReadChar(); // Waits for a single character input to pause the screen.
         }
     } while (choice != 0); // The loop continues until the user chooses 0.
 }
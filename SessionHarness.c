@@ -0,0 +1,424 @@
+#include <stdio.h>      // Includes standard input/output functions like printf and popen.
+#include <stdlib.h>     // Includes standard library functions like malloc, qsort and exit.
+#include <string.h>     // Includes string handling functions like strcmp and strcspn.
+
+#include "SessionMetrics.h" // Includes the wall clock and the action log format shared with the system.
+
+#ifdef _WIN32 // If compiling on Windows,
+#include <direct.h> // Includes _chdir.
+#define popen _popen // Maps popen to the Windows name.
+#define pclose _pclose // Maps pclose to the Windows name.
+#define chdir _chdir // Maps chdir to the Windows name.
+#define setActionLog(path) _putenv_s(SESSION_ACTION_LOG_ENV, path) // Sets the action log for the next operator.
+#define NULL_DEVICE "NUL" // Names the device that discards operator screen output.
+#else // On POSIX systems,
+#include <unistd.h> // Includes chdir.
+#define setActionLog(path) setenv(SESSION_ACTION_LOG_ENV, path, 1) // Sets the action log for the next operator.
+#define NULL_DEVICE "/dev/null" // Names the device that discards operator screen output.
+#endif
+
+#define SCRIPT_LINE_LENGTH 512 // Defines the longest input line a session script may hold.
+#define MAX_OPERATORS 256 // Defines the most simulated operators a load test may run.
+#define MAX_ACTION_KINDS 64 // Defines the most distinct menu actions the report tracks.
+#define HARNESS_PATH_LENGTH 1024 // Defines the longest path or command the harness builds.
+
+// Latency samples for one menu action, such as choice 1 of the product menu.
+typedef struct
+{
+    char menu[32]; // The menu the action belongs to.
+    int choice; // The menu choice that started the action.
+    double *samples; // Every measured latency, in milliseconds.
+    int count; // The number of samples.
+    int capacity; // The number of samples allocated.
+} ActionStats;
+
+// The input lines of a session script.
+typedef struct
+{
+    char **lines; // Each line the operator types, without its newline.
+    int count; // The number of lines.
+} SessionScript;
+
+int recordSession(const char *scriptPath, const char *programPath); // Declares the function that records a live session.
+int replaySession(const char *scriptPath, const char *programPath); // Declares the function that replays one session.
+int runLoadTest(const char *scriptPath, int operatorCount, const char *dataDir, const char *programPath); // Declares the load test.
+int loadScript(const char *scriptPath, SessionScript *script); // Declares the function that reads a script.
+void freeScript(SessionScript *script); // Declares the function that frees a script.
+int collectActionStats(int operatorCount, const char *recordKind, ActionStats *stats, int *kindCount); // Declares the function that reads the action logs.
+void printLatencyReport(const char *title, ActionStats *stats, int kindCount, double elapsedMs); // Declares the function that prints latencies.
+int checkDataConsistency(void); // Declares the function that checks the data files after a run.
+void printUsage(const char *harnessName); // Declares the function that prints usage.
+
+int main(int argc, char *argv[]) // The harness starts here.
+{
+    if (argc == 4 && strcmp(argv[1], "record") == 0) // Checks for "record <script> <program>".
+    {
+        return recordSession(argv[2], argv[3]) ? 0 : 1; // Records a session.
+    }
+    if (argc == 4 && strcmp(argv[1], "replay") == 0) // Checks for "replay <script> <program>".
+    {
+        return replaySession(argv[2], argv[3]) ? 0 : 1; // Replays a session.
+    }
+    if (argc == 6 && strcmp(argv[1], "load") == 0) // Checks for "load <script> <operators> <dataDir> <program>".
+    {
+        int operatorCount = atoi(argv[3]); // Converts the operator count.
+        if (operatorCount < 1 || operatorCount > MAX_OPERATORS) // Checks the operator count is in range.
+        {
+            printf("Operator count must be between 1 and %d.\n", MAX_OPERATORS); // Prints an error message.
+            return 1; // Returns 1 to indicate failure.
+        }
+        return runLoadTest(argv[2], operatorCount, argv[4], argv[5]); // Runs the load test; non-zero means violations.
+    }
+    printUsage(argv[0]); // Explains how to run the harness.
+    return 1; // Returns 1 to indicate failure.
+}
+
+void printUsage(const char *harnessName) // Function to print how to run the harness.
+{
+    printf("Usage:\n"); // Prints the usage title.
+    printf("  %s record <script> <program>\n", harnessName); // Explains record mode.
+    printf("      Runs <program> interactively and saves every line you type to <script>.\n"); // Describes record mode.
+    printf("  %s replay <script> <program>\n", harnessName); // Explains replay mode.
+    printf("      Feeds <script> to <program> as if an operator typed it.\n"); // Describes replay mode.
+    printf("  %s load <script> <operators> <dataDir> <program>\n", harnessName); // Explains load mode.
+    printf("      Replays <script> from N concurrent operators sharing <dataDir>, then reports\n"); // Describes load mode.
+    printf("      throughput, per-menu-action latency and data-consistency violations.\n"); // Continues the description.
+    printf("      <program> is resolved from inside <dataDir>, so give an absolute path.\n"); // Warns about relative paths.
+}
+
+int recordSession(const char *scriptPath, const char *programPath) // Function to record a live session to a script.
+{
+    FILE *script = fopen(scriptPath, "w"); // Opens the script file for writing.
+    if (script == NULL) // Checks if the file failed to open.
+    {
+        printf("Error: Could not create script '%s'.\n", scriptPath); // Prints an error message.
+        return 0; // Returns 0 to indicate failure.
+    }
+    FILE *program = popen(programPath, "w"); // Starts the program with a pipe to its input.
+    if (program == NULL) // Checks if the program failed to start.
+    {
+        printf("Error: Could not start '%s'.\n", programPath); // Prints an error message.
+        fclose(script); // Closes the script file.
+        return 0; // Returns 0 to indicate failure.
+    }
+
+    char line[SCRIPT_LINE_LENGTH]; // A buffer for each line the operator types.
+    while (fgets(line, sizeof(line), stdin) != NULL) // Reads the operator's input until they end it (Ctrl+D / Ctrl+Z).
+    {
+        fputs(line, script); // Saves the line to the script.
+        fflush(script); // Flushes so the script survives if the program crashes.
+        if (fputs(line, program) == EOF || fflush(program) == EOF) break; // Forwards the line; stops if the program has exited.
+    }
+    pclose(program); // Waits for the program to finish.
+    fclose(script); // Closes the script file.
+    printf("Session saved to '%s'.\n", scriptPath); // Confirms where the script was written.
+    return 1; // Returns 1 to indicate success.
+}
+
+int loadScript(const char *scriptPath, SessionScript *script) // Function to read every line of a script into memory.
+{
+    script->lines = NULL; // Starts with no lines.
+    script->count = 0; // Starts with a count of zero.
+    FILE *file = fopen(scriptPath, "r"); // Opens the script file.
+    if (file == NULL) // Checks if the file failed to open.
+    {
+        printf("Error: Could not open script '%s'.\n", scriptPath); // Prints an error message.
+        return 0; // Returns 0 to indicate failure.
+    }
+
+    int capacity = 0; // The number of lines allocated.
+    char line[SCRIPT_LINE_LENGTH]; // A buffer for each line.
+    while (fgets(line, sizeof(line), file) != NULL) // Reads the script line by line.
+    {
+        line[strcspn(line, "\r\n")] = '\0'; // Removes the newline.
+        if (script->count == capacity) // Checks if the array is full.
+        {
+            capacity = capacity ? capacity * 2 : 64; // Doubles the capacity.
+            char **grown = realloc(script->lines, capacity * sizeof(char *)); // Grows the array.
+            if (grown == NULL) break; // Stops reading if memory ran out.
+            script->lines = grown; // Stores the grown array.
+        }
+        script->lines[script->count] = malloc(strlen(line) + 1); // Allocates space for the line.
+        if (script->lines[script->count] == NULL) break; // Stops reading if memory ran out.
+        strcpy(script->lines[script->count++], line); // Copies the line and counts it.
+    }
+    fclose(file); // Closes the script file.
+    return 1; // Returns 1 to indicate success.
+}
+
+void freeScript(SessionScript *script) // Function to free the lines of a script.
+{
+    for (int i = 0; i < script->count; i++) free(script->lines[i]); // Frees each line.
+    free(script->lines); // Frees the array.
+    script->lines = NULL; // Clears the pointer.
+    script->count = 0; // Resets the count.
+}
+
+int replaySession(const char *scriptPath, const char *programPath) // Function to replay one session with its output shown.
+{
+    SessionScript script; // Holds the script lines.
+    if (!loadScript(scriptPath, &script)) return 0; // Reads the script, failing if it cannot be opened.
+
+    FILE *program = popen(programPath, "w"); // Starts the program with a pipe to its input.
+    if (program == NULL) // Checks if the program failed to start.
+    {
+        printf("Error: Could not start '%s'.\n", programPath); // Prints an error message.
+        freeScript(&script); // Frees the script.
+        return 0; // Returns 0 to indicate failure.
+    }
+    for (int i = 0; i < script.count; i++) // Walks the script.
+    {
+        fprintf(program, "%s\n", script.lines[i]); // Types each line into the program.
+    }
+    int status = pclose(program); // Closes the input (end of session) and waits for the program.
+    freeScript(&script); // Frees the script.
+    return status == 0; // Returns 1 if the program exited cleanly.
+}
+
+int runLoadTest(const char *scriptPath, int operatorCount, const char *dataDir, const char *programPath) // Function to run N concurrent operators.
+{
+    SessionScript script; // Holds the script lines.
+    if (!loadScript(scriptPath, &script)) return 1; // Reads the script before changing directory.
+    if (chdir(dataDir) != 0) // Moves into the shared data directory, where the program finds its files.
+    {
+        printf("Error: Could not enter data directory '%s'.\n", dataDir); // Prints an error message.
+        freeScript(&script); // Frees the script.
+        return 1; // Returns 1 to indicate failure.
+    }
+
+    FILE *operators[MAX_OPERATORS]; // The input pipe of each simulated operator.
+    char path[HARNESS_PATH_LENGTH]; // A buffer for log names and commands.
+    int started = 0; // Counts the operators that started.
+    double startMs = sessionNowMs(); // Remembers when the run began.
+    for (int i = 0; i < operatorCount; i++) // Starts every operator.
+    {
+        snprintf(path, sizeof(path), "session_operator_%d.log", i + 1); // Names this operator's action log.
+        remove(path); // Clears the log left by an earlier run.
+        setActionLog(path); // Passes the log name to the operator through its environment.
+        snprintf(path, sizeof(path), "%s > %s", programPath, NULL_DEVICE); // Discards the operator's screen output.
+        operators[i] = popen(path, "w"); // Starts the operator.
+        if (operators[i] != NULL) started++; // Counts it if it started.
+        else printf("Warning: Operator %d could not be started.\n", i + 1); // Warns about a failed start.
+    }
+
+    for (int line = 0; line < script.count; line++) // Interleaves the operators line by line, like staff typing at once.
+    {
+        for (int i = 0; i < operatorCount; i++) // Walks the operators.
+        {
+            if (operators[i] == NULL) continue; // Skips operators that did not start.
+            fprintf(operators[i], "%s\n", script.lines[line]); // Types the next line for this operator.
+            fflush(operators[i]); // Sends it now so the operators really run side by side.
+        }
+    }
+
+    int abnormalExits = 0; // Counts operators that did not exit cleanly.
+    for (int i = 0; i < operatorCount; i++) // Walks the operators.
+    {
+        if (operators[i] != NULL && pclose(operators[i]) != 0) abnormalExits++; // Ends each session and checks how it exited.
+    }
+    double elapsedMs = sessionNowMs() - startMs; // Measures the whole run.
+    freeScript(&script); // Frees the script.
+
+    ActionStats stats[MAX_ACTION_KINDS]; // The latency samples of each distinct leaf action.
+    int kindCount = 0; // The number of distinct actions seen.
+    int totalActions = collectActionStats(operatorCount, "action", stats, &kindCount); // Reads the leaf actions from every log.
+    ActionStats sessions[MAX_ACTION_KINDS]; // The samples of each submenu session, kept out of the action totals.
+    int sessionKindCount = 0; // The number of distinct sessions seen.
+    collectActionStats(operatorCount, "session", sessions, &sessionKindCount); // Reads the submenu sessions from every log.
+
+    printf("\n=== Load Test Report ===\n"); // Prints the report title.
+    printf("Operators started   : %d of %d\n", started, operatorCount); // Prints how many operators ran.
+    printf("Abnormal exits      : %d\n", abnormalExits); // Prints how many sessions ended badly.
+    printf("Wall time           : %.1f ms\n", elapsedMs); // Prints the total run time.
+    printf("Menu actions        : %d\n", totalActions); // Prints how many actions completed.
+    printf("Throughput          : %.2f actions/s\n", elapsedMs > 0 ? totalActions * 1000.0 / elapsedMs : 0.0); // Prints actions per second.
+    printf("(Latencies are work time: time spent waiting on stdin is left out.)\n"); // Explains what the latencies measure.
+    printLatencyReport("Menu actions", stats, kindCount, elapsedMs); // Prints the per-action latencies.
+    printLatencyReport("Submenu sessions (not counted as actions)", sessions, sessionKindCount, elapsedMs); // Prints the whole submenu visits.
+
+    int violations = checkDataConsistency(); // Checks the shared data files for damage.
+    printf("\nConsistency violations: %d\n", violations); // Prints the number of problems found.
+    return violations > 0 || abnormalExits > 0; // Returns non-zero if anything went wrong.
+}
+
+int collectActionStats(int operatorCount, const char *recordKind, ActionStats *stats, int *kindCount) // Function to read one kind of record ("action" or "session") from every log.
+{
+    int totalActions = 0; // Counts every logged action.
+    char path[HARNESS_PATH_LENGTH]; // A buffer for each log name.
+    char line[256]; // A buffer for each log line.
+    for (int i = 0; i < operatorCount; i++) // Walks the operators.
+    {
+        snprintf(path, sizeof(path), "session_operator_%d.log", i + 1); // Builds this operator's log name.
+        FILE *file = fopen(path, "r"); // Opens the log.
+        if (file == NULL) continue; // Skips operators that logged nothing.
+        while (fgets(line, sizeof(line), file) != NULL) // Reads the log line by line.
+        {
+            char kindName[16]; // The record kind ("action" or "session").
+            char menu[32]; // The menu of the action.
+            int choice; // The choice of the action.
+            double latency; // The latency of the action.
+            if (sscanf(line, "%15[^,],%31[^,],%d,%lf", kindName, menu, &choice, &latency) != 4) continue; // Skips malformed lines.
+            if (strcmp(kindName, recordKind) != 0) continue; // Skips records of the other kind.
+
+            int kind = 0; // Finds (or adds) the stats entry for this action.
+            while (kind < *kindCount && !(strcmp(stats[kind].menu, menu) == 0 && stats[kind].choice == choice)) kind++; // Searches the known actions.
+            if (kind == *kindCount) // Checks if this action is new.
+            {
+                if (*kindCount == MAX_ACTION_KINDS) continue; // Ignores actions beyond the table size.
+                strcpy(stats[kind].menu, menu); // Records the menu.
+                stats[kind].choice = choice; // Records the choice.
+                stats[kind].samples = NULL; // Starts with no samples.
+                stats[kind].count = stats[kind].capacity = 0; // Resets the counters.
+                (*kindCount)++; // Counts the new action.
+            }
+            if (stats[kind].count == stats[kind].capacity) // Checks if the sample array is full.
+            {
+                int newCapacity = stats[kind].capacity ? stats[kind].capacity * 2 : 32; // Doubles the capacity.
+                double *grown = realloc(stats[kind].samples, newCapacity * sizeof(double)); // Grows the array.
+                if (grown == NULL) continue; // Drops the sample if memory ran out.
+                stats[kind].samples = grown; // Stores the grown array.
+                stats[kind].capacity = newCapacity; // Records the new capacity.
+            }
+            stats[kind].samples[stats[kind].count++] = latency; // Stores the sample.
+            totalActions++; // Counts the action.
+        }
+        fclose(file); // Closes the log.
+    }
+    return totalActions; // Returns the number of actions read.
+}
+
+static int compareDoubles(const void *a, const void *b) // Orders latency samples for qsort.
+{
+    double left = *(const double *)a, right = *(const double *)b; // Reads both samples.
+    return (left > right) - (left < right); // Returns -1, 0 or 1.
+}
+
+void printLatencyReport(const char *title, ActionStats *stats, int kindCount, double elapsedMs) // Function to print latency per menu action.
+{
+    printf("\n%s:", title); // Prints the table title.
+    printf("\n%-10s %6s %7s %10s %10s %10s %10s\n", "Menu", "Choice", "Count", "Avg ms", "p95 ms", "Max ms", "Ops/s"); // Prints the table header.
+    for (int i = 0; i < kindCount; i++) // Walks the actions.
+    {
+        ActionStats *action = &stats[i]; // Points at this action.
+        qsort(action->samples, action->count, sizeof(double), compareDoubles); // Sorts the samples for percentiles.
+        double sum = 0; // Totals the samples.
+        for (int j = 0; j < action->count; j++) sum += action->samples[j]; // Adds each sample.
+        int p95Index = (int)(action->count * 0.95); // Finds the 95th percentile position.
+        if (p95Index >= action->count) p95Index = action->count - 1; // Keeps it inside the array.
+        printf("%-10s %6d %7d %10.3f %10.3f %10.3f %10.2f\n", action->menu, action->choice, action->count,
+               sum / action->count, action->samples[p95Index], action->samples[action->count - 1],
+               elapsedMs > 0 ? action->count * 1000.0 / elapsedMs : 0.0); // Prints the row.
+        free(action->samples); // Frees the samples once printed.
+    }
+}
+
+// A private helper function to count the comma-separated fields of a line.
+static int countFields(const char *line)
+{
+    int fields = 1; // A line always has at least one field.
+    for (; *line; line++) if (*line == ',') fields++; // Counts the separators.
+    return fields; // Returns the number of fields.
+}
+
+// A private helper function to check one data file for torn lines and duplicate IDs.
+// minimumFields is 0 when the file's field count is not fixed. The last field is free text and may itself contain
+// commas, so only lines with fewer fields than that are reported as torn. Returns the number of violations.
+static int checkRecordFile(const char *fileName, int minimumFields)
+{
+    FILE *file = fopen(fileName, "r"); // Opens the data file.
+    if (file == NULL) return 0; // A missing file has nothing to check.
+
+    int violations = 0; // Counts problems in this file.
+    int count = 0, capacity = 0; // Tracks the IDs seen so far.
+    char (*ids)[64] = NULL; // The IDs seen so far.
+    char line[1024]; // A buffer for each record.
+    int lineNumber = 0; // The current line number, for messages.
+    while (fgets(line, sizeof(line), file) != NULL) // Reads the file line by line.
+    {
+        lineNumber++; // Counts the line.
+        line[strcspn(line, "\r\n")] = '\0'; // Removes the newline.
+        if (line[0] == '\0') continue; // Skips blank lines.
+        if (minimumFields > 0 && countFields(line) < minimumFields) // Checks for truncated writes.
+        {
+            printf("  %s:%d: expected at least %d fields, found %d\n", fileName, lineNumber, minimumFields, countFields(line)); // Reports the torn line.
+            violations++; // Counts the violation.
+        }
+
+        char id[64]; // The record's ID.
+        size_t length = strcspn(line, ","); // Finds the end of the first field.
+        if (length >= sizeof(id)) length = sizeof(id) - 1; // Truncates overly long IDs.
+        memcpy(id, line, length); // Copies the ID.
+        id[length] = '\0'; // Terminates the ID.
+        for (int i = 0; i < count; i++) // Looks for an earlier record with the same ID.
+        {
+            if (strcmp(ids[i], id) == 0) // Checks for a duplicate.
+            {
+                printf("  %s:%d: duplicate ID '%s'\n", fileName, lineNumber, id); // Reports the duplicate.
+                violations++; // Counts the violation.
+                break; // One report per line is enough.
+            }
+        }
+        if (count == capacity) // Checks if the ID array is full.
+        {
+            capacity = capacity ? capacity * 2 : 64; // Doubles the capacity.
+            char (*grown)[64] = realloc(ids, capacity * sizeof(*ids)); // Grows the array.
+            if (grown == NULL) break; // Stops checking if memory ran out.
+            ids = grown; // Stores the grown array.
+        }
+        strcpy(ids[count++], id); // Remembers the ID.
+    }
+    free(ids); // Frees the IDs.
+    fclose(file); // Closes the file.
+    return violations; // Returns the number of problems found.
+}
+
+int checkDataConsistency(void) // Function to check the shared data files after a run.
+{
+    printf("\n--- Consistency Check ---\n"); // Prints the section title.
+    int violations = 0; // Counts every problem found.
+    violations += checkRecordFile("admins.txt", 6); // Admin lines hold six fields.
+    violations += checkRecordFile("inventory.txt", 6); // Product lines hold six fields; the description may contain commas.
+    violations += checkRecordFile("categories.txt", 3); // Category lines hold three fields; the description may contain commas.
+    violations += checkRecordFile("suppliers.txt", 0); // Supplier IDs must be unique.
+    violations += checkRecordFile("customers.txt", 0); // Customer IDs must be unique.
+    violations += checkRecordFile("transactions.txt", 0); // Transaction IDs must be unique.
+
+    FILE *file = fopen("inventory.txt", "r"); // Re-opens the inventory to check values and references.
+    if (file != NULL) // Checks values only if the inventory exists.
+    {
+        char productID[64], categoryID[64], name[64], price[64], quantity[64], description[256]; // Field buffers.
+        while (fscanf(file, "%63[^,],%63[^,],%63[^,],%63[^,],%63[^,],%255[^\n]\n", productID, categoryID, name, price, quantity, description) == 6) // Reads each product.
+        {
+            if (atoi(quantity) < 0) // Checks for a negative stock level.
+            {
+                printf("  inventory.txt: product %s has negative quantity %s\n", productID, quantity); // Reports it.
+                violations++; // Counts the violation.
+            }
+            if (atof(price) < 0) // Checks for a negative price.
+            {
+                printf("  inventory.txt: product %s has negative price %s\n", productID, price); // Reports it.
+                violations++; // Counts the violation.
+            }
+
+            FILE *categories = fopen("categories.txt", "r"); // Opens the categories to check the reference.
+            if (categories == NULL) continue; // Skips the reference check without a category file.
+            char line[512]; // A buffer for each category.
+            int found = 0, anyCategory = 0; // Tracks whether the category exists.
+            size_t idLength = strlen(categoryID); // The length of the referenced ID.
+            while (!found && fgets(line, sizeof(line), categories) != NULL) // Scans the categories.
+            {
+                anyCategory = 1; // Notes that at least one category exists.
+                found = strncmp(line, categoryID, idLength) == 0 && line[idLength] == ','; // Compares the first field.
+            }
+            fclose(categories); // Closes the categories.
+            if (anyCategory && !found) // Checks for a dangling reference.
+            {
+                printf("  inventory.txt: product %s refers to missing category %s\n", productID, categoryID); // Reports it.
+                violations++; // Counts the violation.
+            }
+        }
+        fclose(file); // Closes the inventory.
+    }
+    if (violations == 0) printf("  No violations found.\n"); // Reports a clean run.
+    return violations; // Returns the number of problems found.
+}
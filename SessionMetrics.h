@@ -0,0 +1,78 @@
+#ifndef SESSION_METRICS_H // If SESSION_METRICS_H is not defined,
+#define SESSION_METRICS_H // Define SESSION_METRICS_H to prevent multiple inclusions.
+
+#include <stdio.h> // Includes standard input/output functions.
+#include <stdlib.h> // Includes getenv.
+#include <time.h> // Includes timespec_get for wall-clock timing.
+
+#define SESSION_ACTION_LOG_ENV "ICP_ACTION_LOG" // Names the environment variable that turns action timing on.
+
+// Returns the current wall-clock time in milliseconds.
+static inline double sessionNowMs()
+{
+    struct timespec now; // Holds the current time.
+    timespec_get(&now, TIME_UTC); // Reads the wall clock.
+    return now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0; // Converts seconds and nanoseconds to milliseconds.
+}
+
+// The time spent blocked on stdin so far, so that action timings can leave out the operator's typing.
+static double sessionInputWaitMs = 0.0;
+
+// The start of a timed action or submenu session.
+typedef struct
+{
+    double startMs; // The wall-clock time the action started.
+    double inputWaitAtStartMs; // The stdin wait total when the action started.
+} SessionTimer;
+
+// Reads one line from stdin like fgets, adding the time spent waiting to the stdin wait total.
+static inline char *sessionReadLine(char *buffer, int size)
+{
+    double startMs = sessionNowMs(); // Remembers when the wait began.
+    char *result = fgets(buffer, size, stdin); // Waits for the line.
+    sessionInputWaitMs += sessionNowMs() - startMs; // Adds the wait to the total.
+    return result; // Returns what fgets returned.
+}
+
+// Reads one character from stdin like getchar (used by "Press Enter" pauses), adding the wait to the stdin wait total.
+static inline int sessionReadChar()
+{
+    double startMs = sessionNowMs(); // Remembers when the wait began.
+    int result = getchar(); // Waits for the character.
+    sessionInputWaitMs += sessionNowMs() - startMs; // Adds the wait to the total.
+    return result; // Returns what getchar returned.
+}
+
+// Starts timing an action or submenu session.
+static inline SessionTimer sessionStartTimer()
+{
+    SessionTimer timer = {sessionNowMs(), sessionInputWaitMs}; // Captures the clock and the stdin wait total.
+    return timer; // Returns the timer.
+}
+
+// A private helper function to append "kind,menu,choice,elapsedMs" to the file named by ICP_ACTION_LOG.
+// The elapsed time leaves out any time spent waiting on stdin. Does nothing when ICP_ACTION_LOG is not set.
+static inline void sessionWriteTiming(const char *kind, const char *menu, int choice, SessionTimer timer)
+{
+    const char *logPath = getenv(SESSION_ACTION_LOG_ENV); // Looks up the action log file.
+    if (logPath == NULL || logPath[0] == '\0') return; // Timing is off unless the harness asked for it.
+    double elapsedMs = sessionNowMs() - timer.startMs - (sessionInputWaitMs - timer.inputWaitAtStartMs); // Work time without stdin waits.
+    FILE *file = fopen(logPath, "a"); // Opens the action log in append mode.
+    if (file == NULL) return; // Timing must never interrupt the user, so failures are ignored.
+    fprintf(file, "%s,%s,%d,%.3f\n", kind, menu, choice, elapsedMs); // Writes the kind, menu, choice and elapsed time.
+    fclose(file); // Closes the log so each line is flushed immediately.
+}
+
+// Logs one leaf menu action, such as adding a product.
+static inline void sessionRecordAction(const char *menu, int choice, SessionTimer timer)
+{
+    sessionWriteTiming("action", menu, choice, timer); // Writes an "action" line.
+}
+
+// Logs a whole visit to a submenu; the harness reports these apart from actions so nothing is counted twice.
+static inline void sessionRecordSession(const char *menu, int choice, SessionTimer timer)
+{
+    sessionWriteTiming("session", menu, choice, timer); // Writes a "session" line.
+}
+
+#endif // Marks the end of the SESSION_METRICS_H header guard.
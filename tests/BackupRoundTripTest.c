@@ -0,0 +1,122 @@
+// Round-trip test for BackupManagement.h against local scratch directories.
+// Build and run from the repository root:
+//   gcc -std=gnu11 -I. tests/BackupRoundTripTest.c -o backup_test && ./backup_test
+// Exits with 0 when every check passes.
+
+#include <stdio.h>      // Includes standard input/output functions like printf and fopen.
+#include <stdlib.h>     // Includes standard library functions like system.
+#include <string.h>     // Includes string handling functions like strcmp.
+#include <unistd.h>     // Includes fork for the lock check.
+#include <sys/wait.h>   // Includes waitpid for the lock check.
+
+#include "BackupManagement.h" // Includes the backup, restore and replica functions under test.
+
+#define TEST_ROOT "backup_test_tmp" // Defines the scratch directory the test works in.
+
+int failures = 0; // Counts failed checks.
+
+void check(int condition, const char *description) // Function to record the result of one check.
+{
+    printf("%s %s\n", condition ? "PASS" : "FAIL", description); // Prints the result.
+    if (!condition) failures++; // Counts a failure.
+}
+
+void writeFile(const char *path, const char *contents) // Function to replace a file's contents.
+{
+    FILE *file = fopen(path, "w"); // Opens the file for writing.
+    if (file == NULL) return; // Leaves the failure to the checks that follow.
+    fputs(contents, file); // Writes the contents.
+    fclose(file); // Closes the file.
+}
+
+int filesMatch(const char *pathA, const char *pathB) // Function to compare two files byte for byte.
+{
+    FILE *a = fopen(pathA, "rb"), *b = fopen(pathB, "rb"); // Opens both files.
+    int same = a != NULL && b != NULL; // Two missing files do not count as a match.
+    while (same) // Compares the files one byte at a time.
+    {
+        int byteA = fgetc(a), byteB = fgetc(b); // Reads the next byte of each.
+        if (byteA != byteB) same = 0; // Stops at the first difference.
+        if (byteA == EOF || byteB == EOF) break; // Stops at the end of either file.
+    }
+    if (a) fclose(a); // Closes the first file.
+    if (b) fclose(b); // Closes the second file.
+    return same; // Returns 1 if the files are identical.
+}
+
+int directoriesMatch(const char *dirA, const char *dirB) // Function to compare every data file in two directories.
+{
+    char pathA[BACKUP_PATH_LENGTH], pathB[BACKUP_PATH_LENGTH]; // Path buffers.
+    for (int i = 0; i < BACKUP_DATA_FILE_COUNT; i++) // Walks every data file.
+    {
+        backupJoinPath(pathA, sizeof(pathA), dirA, BACKUP_DATA_FILES[i]); // Builds the first path.
+        backupJoinPath(pathB, sizeof(pathB), dirB, BACKUP_DATA_FILES[i]); // Builds the second path.
+        if (!filesMatch(pathA, pathB)) // Compares the files.
+        {
+            printf("     %s differs\n", BACKUP_DATA_FILES[i]); // Names the file that differs.
+            return 0; // Returns 0 on the first difference.
+        }
+    }
+    return 1; // Returns 1 if every file matches.
+}
+
+int lockFreeInChild(const char *backupDir) // Function to check, from another process, whether the backup lock can be taken.
+{
+    pid_t child = fork(); // Starts a second process.
+    if (child == 0) // In the child,
+    {
+        backupLockDepth = 0; // Forgets the parent's hold, like a freshly started operator process.
+        _exit(backupLockAcquire(backupDir, 0) ? 0 : 1); // Reports whether it got the lock.
+    }
+    int status = 1; // The child's exit status.
+    waitpid(child, &status, 0); // Waits for the child.
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0; // Returns 1 if the child got the lock.
+}
+
+int main() // The test starts here.
+{
+    system("rm -rf " TEST_ROOT); // Clears any leftovers from an earlier run.
+    backupEnsureDirectory(TEST_ROOT); // Creates the scratch directory.
+    backupEnsureDirectory(TEST_ROOT "/data"); // Creates the live data directory.
+    backupEnsureDirectory(TEST_ROOT "/replica"); // Creates the replica directory.
+
+    char path[BACKUP_PATH_LENGTH]; // A buffer for data file paths.
+    for (int i = 0; i < BACKUP_DATA_FILE_COUNT; i++) // Gives every data file a couple of records.
+    {
+        backupJoinPath(path, sizeof(path), TEST_ROOT "/data", BACKUP_DATA_FILES[i]); // Builds the data file path.
+        writeFile(path, "ID1,first,1\nID2,second,2\n"); // Writes the records.
+    }
+    writeFile(TEST_ROOT "/data/inventory.txt", "P1,C1,Apple,1.00,10,Fruit\nP2,C1,Pear,2.00,3,Fruit\nP3,C1,Plum,2.00,7,Fruit\n"); // Writes products.
+
+    check(performFullBackup(TEST_ROOT "/data", TEST_ROOT "/backup"), "full backup succeeds"); // Takes the full backup.
+    check(performIncrementalBackup(TEST_ROOT "/data", TEST_ROOT "/backup") == 0, "incremental backup with no edits finds nothing"); // Nothing changed yet.
+    check(syncReplica(TEST_ROOT "/data", TEST_ROOT "/backup", TEST_ROOT "/replica"), "replica is created"); // Builds the replica.
+
+    // Edits in the same second as the full backup: P1 changes with the same file size, P2 is deleted and P4 is added.
+    writeFile(TEST_ROOT "/data/inventory.txt", "P1,C1,Apple,1.00,20,Fruit\nP3,C1,Plum,2.00,7,Fruit\nP4,C1,Kiwi,3.00,5,Fruit\n"); // Rewrites the products.
+    writeFile(TEST_ROOT "/data/customers.txt", "ID1,first,1\nID2,second,2\nID3,third,3\n"); // Adds a customer.
+    check(performIncrementalBackup(TEST_ROOT "/data", TEST_ROOT "/backup") == 4, "incremental backup ships exactly the 4 changed records"); // Edit, delete, two adds.
+    check(performIncrementalBackup(TEST_ROOT "/data", TEST_ROOT "/backup") == 0, "a second incremental backup finds nothing new"); // The manifests moved on.
+
+    check(restoreFromBackup(TEST_ROOT "/backup", TEST_ROOT "/restored"), "restore succeeds"); // Rebuilds from full + deltas.
+    check(directoriesMatch(TEST_ROOT "/data", TEST_ROOT "/restored"), "restored files match the live data"); // Diffs the result.
+    check(syncReplica(TEST_ROOT "/data", TEST_ROOT "/backup", TEST_ROOT "/replica"), "replica sync succeeds"); // Ships the deltas.
+    check(directoriesMatch(TEST_ROOT "/data", TEST_ROOT "/replica"), "replica files match the live data"); // Diffs the replica.
+
+    writeFile(TEST_ROOT "/data/suppliers.txt", "ID1,first,1\n"); // Deletes a supplier.
+    check(performFullBackup(TEST_ROOT "/data", TEST_ROOT "/backup"), "second full backup succeeds"); // Starts a new generation.
+    check(restoreFromBackup(TEST_ROOT "/backup", TEST_ROOT "/restored2"), "restore after a new full backup succeeds"); // Restores the new generation.
+    check(directoriesMatch(TEST_ROOT "/data", TEST_ROOT "/restored2"), "restore after a new full backup matches the live data"); // Diffs the result.
+    check(syncReplica(TEST_ROOT "/data", TEST_ROOT "/backup", TEST_ROOT "/replica"), "replica follows the new generation"); // Rebuilds the replica.
+    check(directoriesMatch(TEST_ROOT "/data", TEST_ROOT "/replica"), "replica matches after the new generation"); // Diffs the replica.
+
+    check(backupLockAcquire(TEST_ROOT "/backup", 1), "the backup lock can be taken"); // Holds the lock like a running backup.
+    check(!lockFreeInChild(TEST_ROOT "/backup"), "a second process cannot take the backup lock while it is held"); // Another operator must wait.
+    check(performIncrementalBackup(TEST_ROOT "/data", TEST_ROOT "/backup") == 0, "the lock holder can still run backups"); // The lock is re-entrant.
+    backupLockRelease(); // Releases the lock.
+    check(lockFreeInChild(TEST_ROOT "/backup"), "the backup lock is free again after release"); // Other operators can go on.
+
+    system("rm -rf " TEST_ROOT); // Removes the scratch directory.
+    printf("%d failure(s)\n", failures); // Prints the summary.
+    return failures != 0; // Returns non-zero if any check failed.
+}
@@ -0,0 +1,82 @@
+// Test for LowStockMonitor.h: hooked writes update the reorder heap without a rescan, other writes force one.
+// Build and run from the repository root (FileHandling.h must be on the include path):
+//   gcc -std=gnu11 -I. tests/LowStockMonitorTest.c -o low_stock_test && ./low_stock_test
+// Exits with 0 when every check passes.
+
+#include <stdio.h>      // Includes standard input/output functions like printf and fopen.
+#include <stdlib.h>     // Includes standard library functions like system.
+#include <string.h>     // Includes string handling functions like strcmp.
+#include <unistd.h>     // Includes chdir to work inside the scratch directory.
+#include <utime.h>      // Includes utime to make the starting inventory look old.
+
+#include "LowStockMonitor.h" // Includes the low-stock monitor under test.
+
+#define TEST_ROOT "low_stock_test_tmp" // Defines the scratch directory the test works in.
+
+int failures = 0; // Counts failed checks.
+
+void check(int condition, const char *description) // Function to record the result of one check.
+{
+    printf("%s %s\n", condition ? "PASS" : "FAIL", description); // Prints the result.
+    if (!condition) failures++; // Counts a failure.
+}
+
+void writeFile(const char *path, const char *contents) // Function to replace a file's contents.
+{
+    FILE *file = fopen(path, "w"); // Opens the file for writing.
+    if (file == NULL) return; // Leaves the failure to the checks that follow.
+    fputs(contents, file); // Writes the contents.
+    fclose(file); // Closes the file.
+}
+
+void hookedQuantityWrite(const char *contents, const char *productID, int quantity) // Function to write inventory.txt the way the product menu does.
+{
+    lowStockBeforeInventoryWrite(); // Lets the monitor notice earlier unhooked writes.
+    writeFile(LOW_STOCK_INVENTORY_FILE, contents); // Writes the file.
+    lowStockOnQuantityChanged(productID, quantity); // Tells the monitor what changed.
+}
+
+int isLow(const char *productID) // Function to check whether a product is on the reorder list.
+{
+    int count; // The number of products on the list.
+    LowStockEntry *list = lowStockReorderList(&count); // Gets the list.
+    int found = 0; // Set if the product is on it.
+    for (int i = 0; i < count; i++) if (strcmp(list[i].productID, productID) == 0) found = 1; // Looks for the product.
+    free(list); // Frees the list.
+    return found; // Returns 1 if the product needs reordering.
+}
+
+int main() // The test starts here.
+{
+    system("rm -rf " TEST_ROOT " && mkdir " TEST_ROOT); // Starts from an empty scratch directory.
+    if (chdir(TEST_ROOT) != 0) return 1; // Works inside it, where the monitor looks for its files.
+
+    writeFile(LOW_STOCK_INVENTORY_FILE, "P1,C1,Apple,1.00,10,Fruit\nP2,C1,Pear,2.00,10,Fruit\n"); // Writes two well-stocked products.
+    struct utimbuf old = {time(NULL) - 60, time(NULL) - 60}; // A minute ago.
+    utime(LOW_STOCK_INVENTORY_FILE, &old); // Makes the file older than the first read.
+
+    check(!isLow("P1") && !isLow("P2"), "nothing needs reordering at first"); // Builds the monitor.
+    check(lowStockMonitor.rebuildCount == 1, "the first query reads the inventory once"); // One full scan.
+
+    hookedQuantityWrite("P1,C1,Apple,1.00,2,Fruit\nP2,C1,Pear,2.00,10,Fruit\n", "P1", 2); // Drops P1 below the default threshold.
+    check(isLow("P1"), "a hooked quantity change puts the product on the list"); // The heap was updated.
+    check(lowStockMonitor.rebuildCount == 1, "a hooked quantity change followed by a query does not rebuild"); // No rescan.
+
+    hookedQuantityWrite("P1,C1,Apple,1.00,2,Fruit\nP2,C1,Pear,2.00,3,Fruit\n", "P2", 3); // Drops P2 in the same second.
+    check(isLow("P1") && isLow("P2"), "a second hooked change in the same second is applied"); // Both are low.
+    check(lowStockMonitor.rebuildCount == 1, "back-to-back hooked changes still do not rebuild"); // Still no rescan.
+
+    writeFile(LOW_STOCK_INVENTORY_FILE, "P1,C1,Apple,1.00,2,Fruit\nP2,C1,Pear,2.00,30,Fruit\n"); // Another module restocks P2.
+    check(!isLow("P2"), "an unhooked write is picked up"); // The monitor rescanned.
+    check(lowStockMonitor.rebuildCount == 2, "an unhooked write forces one rebuild"); // Exactly one rescan.
+
+    writeFile(LOW_STOCK_INVENTORY_FILE, "P1,C1,Apple,1.00,2,Fruit\nP2,C1,Pear,2.00,1,Fruit\n"); // Another module drops P2 ...
+    hookedQuantityWrite("P1,C1,Apple,1.00,40,Fruit\nP2,C1,Pear,2.00,1,Fruit\n", "P1", 40); // ... then the product menu restocks P1.
+    check(isLow("P2") && !isLow("P1"), "a hooked write does not hide an earlier unhooked one"); // Both changes are seen.
+
+    lowStockFree(); // Releases the monitor.
+    if (chdir("..") != 0) return 1; // Leaves the scratch directory.
+    system("rm -rf " TEST_ROOT); // Removes the scratch directory.
+    printf("%d failure(s)\n", failures); // Prints the summary.
+    return failures != 0; // Returns non-zero if any check failed.
+}